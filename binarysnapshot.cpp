@@ -0,0 +1,258 @@
+#include "binarysnapshot.h"
+#include "worklogcolumns.h"
+#include "worktimeindex.h"
+#include "logging.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QBuffer>
+#include <QtEndian>
+#include <QDebug>
+#include <cstring>
+#include <utility>
+#include <limits>
+
+namespace {
+const char kMagic[8] = {'S', 'S', 'U', 'P', 'A', 'Y', 'B', '\0'};
+const int kHeaderSize = 64;
+
+// 헤더 필드 위치
+enum HeaderOffset {
+    OffVersion = 8,
+    OffNextEmployeeId = 12,
+    OffJournalSequence = 16,
+    OffEmployeeCount = 24,
+    OffWorkLogCount = 32,
+    OffEmployeeSectionOffset = 40,
+    OffEmployeeSectionSize = 48,
+    OffColumnSectionOffset = 56
+};
+
+template <typename T>
+void putLE(QByteArray &buffer, int offset, T value)
+{
+    qToLittleEndian<T>(value, buffer.data() + offset);
+}
+
+template <typename T>
+T getLE(const uchar *data, qint64 offset)
+{
+    return qFromLittleEndian<T>(data + offset);
+}
+
+// 열 값이 WorkLogColumns 인코딩 범위 안인지 확인하고, 처음 어긋난 행 번호를 반환 (모두 맞으면 -1)
+// 날짜는 무효(kInvalidDay)이거나 근무 시간 색인의 지원 기간 안, 분은 무효(-1)이거나 0 ~ 1439
+int findInvalidRow(const BinarySnapshot::Contents &contents)
+{
+    const qint32 firstDay = qint32(WorkTimeIndex::kFirstSupportedDay);
+    const qint32 lastDay = qint32(WorkTimeIndex::kLastSupportedDay);
+    const qint16 lastMinute = 24 * 60 - 1;
+    auto isValidMinute = [lastMinute](qint16 minute) {
+        return minute == WorkLogColumns::kInvalidMinute || (minute >= 0 && minute <= lastMinute);
+    };
+    for (int row = 0; row < contents.days.size(); ++row) {
+        const qint32 day = contents.days[row];
+        if (day != WorkLogColumns::kInvalidDay && (day < firstDay || day > lastDay)) return row;
+        if (!isValidMinute(contents.startMinutes[row]) || !isValidMinute(contents.endMinutes[row])) return row;
+    }
+    return -1;
+}
+
+// source가 넘기는 근무 기록에서 열 하나를 골라 리틀 엔디언으로 나누어 씀 (쓴 개수 반환)
+template <typename T, typename Getter>
+qint64 writeColumn(QIODevice *device, const BinarySnapshot::WorkLogSource &source, Getter getter)
+{
+    const int kBufferValues = 32768;
+    QByteArray buffer(kBufferValues * int(sizeof(T)), Qt::Uninitialized);
+    int buffered = 0;
+    qint64 written = 0;
+    source([&](const WorkLog &log) {
+        qToLittleEndian<T>(getter(log), buffer.data() + buffered * sizeof(T));
+        if (++buffered == kBufferValues) {
+            device->write(buffer.constData(), buffer.size());
+            buffered = 0;
+        }
+        ++written;
+    });
+    device->write(buffer.constData(), buffered * qint64(sizeof(T)));
+    return written;
+}
+}
+
+bool BinarySnapshot::isBinarySnapshot(const QString &filename)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+    return file.read(sizeof(kMagic)) == QByteArray(kMagic, sizeof(kMagic));
+}
+
+bool BinarySnapshot::write(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                           const QList<Employee> &employees, const QList<WorkLog> &workLogs)
+{
+    return write(filename, nextEmployeeId, journalSequence, employees, workLogs.size(),
+                 [&workLogs](const WorkLogVisitor &visit) {
+                     for (const WorkLog &log : workLogs) {
+                         visit(log);
+                     }
+                 });
+}
+
+bool BinarySnapshot::write(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                           const QList<Employee> &employees, qint64 workLogCount, const WorkLogSource &source)
+{
+    // 직원 영역 (가변 길이 문자열이 있으므로 QDataStream 사용)
+    QByteArray employeeSection;
+    {
+        QBuffer buffer(&employeeSection);
+        buffer.open(QIODevice::WriteOnly);
+        QDataStream out(&buffer);
+        out.setVersion(QDataStream::Qt_5_15);
+        out.setByteOrder(QDataStream::LittleEndian);
+        for (const Employee &emp : employees) {
+            out << qint32(emp.getId()) << emp.getName() << qint32(emp.getHourlyWage()) << emp.getBankAccount();
+        }
+    }
+
+    const quint64 employeeSectionOffset = kHeaderSize;
+    const quint64 columnSectionOffset = (employeeSectionOffset + employeeSection.size() + 7) & ~quint64(7);
+
+    QByteArray header(kHeaderSize, '\0');
+    std::memcpy(header.data(), kMagic, sizeof(kMagic));
+    putLE<quint32>(header, OffVersion, FormatVersion);
+    putLE<qint32>(header, OffNextEmployeeId, nextEmployeeId);
+    putLE<qint64>(header, OffJournalSequence, journalSequence);
+    putLE<quint32>(header, OffEmployeeCount, quint32(employees.size()));
+    putLE<quint64>(header, OffWorkLogCount, quint64(workLogCount));
+    putLE<quint64>(header, OffEmployeeSectionOffset, employeeSectionOffset);
+    putLE<quint64>(header, OffEmployeeSectionSize, quint64(employeeSection.size()));
+    putLE<quint64>(header, OffColumnSectionOffset, columnSectionOffset);
+
+    QSaveFile saveFile(filename);
+    if (!saveFile.open(QIODevice::WriteOnly)) {
+        qCWarning(lcSnapshot) << "Couldn't open binary snapshot for writing:" << filename;
+        return false;
+    }
+    saveFile.write(header);
+    saveFile.write(employeeSection);
+    saveFile.write(QByteArray(int(columnSectionOffset - employeeSectionOffset - employeeSection.size()), '\0'));
+
+    // 날짜/시간 인코딩은 메모리의 근무 기록 열(WorkLogColumns)과 같음
+    const qint64 counts[] = {
+        writeColumn<qint32>(&saveFile, source, [](const WorkLog &log) { return qint32(log.getEmployeeId()); }),
+        writeColumn<qint32>(&saveFile, source, [](const WorkLog &log) { return WorkLogColumns::encodeDate(log.getDate()); }),
+        writeColumn<qint16>(&saveFile, source, [](const WorkLog &log) { return WorkLogColumns::encodeTime(log.getStartTime()); }),
+        writeColumn<qint16>(&saveFile, source, [](const WorkLog &log) { return WorkLogColumns::encodeTime(log.getEndTime()); }),
+    };
+    for (qint64 count : counts) {
+        if (count != workLogCount) {
+            qCCritical(lcSnapshot) << "Binary snapshot source produced" << count << "work logs, expected" << workLogCount;
+            saveFile.cancelWriting();
+            return false;
+        }
+    }
+
+    if (!saveFile.commit()) {
+        qCCritical(lcSnapshot) << "Failed to write binary snapshot" << filename << ":" << saveFile.errorString();
+        return false;
+    }
+    return true;
+}
+
+bool BinarySnapshot::read(const QString &filename, Contents *contents)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(lcSnapshot) << "Couldn't open binary snapshot for reading:" << filename;
+        return false;
+    }
+
+    const qint64 fileSize = file.size();
+    if (fileSize < kHeaderSize) {
+        qCWarning(lcSnapshot) << "Binary snapshot is too small:" << filename;
+        return false;
+    }
+
+    // 파일 전체를 메모리 매핑 (매핑이 안 되는 장치면 한 번에 읽어서 대신 사용)
+    QByteArray fallback;
+    const uchar *data = file.map(0, fileSize);
+    if (!data) {
+        fallback = file.readAll();
+        data = reinterpret_cast<const uchar *>(fallback.constData());
+    }
+
+    if (std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        qCWarning(lcSnapshot) << "Not a binary snapshot:" << filename;
+        return false;
+    }
+    const quint32 version = getLE<quint32>(data, OffVersion);
+    if (version != FormatVersion) {
+        qCWarning(lcSnapshot) << "Unsupported binary snapshot version" << version << "in" << filename;
+        return false;
+    }
+
+    const quint32 employeeCount = getLE<quint32>(data, OffEmployeeCount);
+    const quint64 workLogCount = getLE<quint64>(data, OffWorkLogCount);
+    const quint64 employeeSectionOffset = getLE<quint64>(data, OffEmployeeSectionOffset);
+    const quint64 employeeSectionSize = getLE<quint64>(data, OffEmployeeSectionSize);
+    const quint64 columnSectionOffset = getLE<quint64>(data, OffColumnSectionOffset);
+    const quint64 columnSectionSize = workLogCount * (sizeof(qint32) * 2 + sizeof(qint16) * 2);
+
+    if (employeeSectionOffset + employeeSectionSize > quint64(fileSize)
+        || workLogCount > quint64(std::numeric_limits<int>::max())
+        || columnSectionOffset + columnSectionSize > quint64(fileSize)) {
+        qCWarning(lcSnapshot) << "Binary snapshot is truncated or corrupt:" << filename;
+        return false;
+    }
+
+    Contents result;
+    result.nextEmployeeId = getLE<qint32>(data, OffNextEmployeeId);
+    result.journalSequence = getLE<qint64>(data, OffJournalSequence);
+
+    // 직원 영역
+    {
+        QByteArray employeeSection = QByteArray::fromRawData(
+            reinterpret_cast<const char *>(data + employeeSectionOffset), int(employeeSectionSize));
+        QDataStream in(employeeSection);
+        in.setVersion(QDataStream::Qt_5_15);
+        in.setByteOrder(QDataStream::LittleEndian);
+        result.employees.reserve(int(employeeCount));
+        for (quint32 i = 0; i < employeeCount; ++i) {
+            qint32 id = -1, wage = 0;
+            QString name, account;
+            in >> id >> name >> wage >> account;
+            if (in.status() != QDataStream::Ok) {
+                qCWarning(lcSnapshot) << "Binary snapshot employee section is corrupt:" << filename;
+                return false;
+            }
+            result.employees.append(Employee(id, name, wage, account));
+        }
+    }
+
+    // 열 영역: 고정 폭 열을 통째로 복사 (리틀 엔디언 기계에서는 memcpy와 같음)
+    const int count = int(workLogCount);
+    const uchar *employeeIds = data + columnSectionOffset;
+    const uchar *julianDays = employeeIds + count * sizeof(qint32);
+    const uchar *startMinutes = julianDays + count * sizeof(qint32);
+    const uchar *endMinutes = startMinutes + count * sizeof(qint16);
+
+    result.employeeIds.resize(count);
+    result.days.resize(count);
+    result.startMinutes.resize(count);
+    result.endMinutes.resize(count);
+    qFromLittleEndian<qint32>(employeeIds, count, result.employeeIds.data());
+    qFromLittleEndian<qint32>(julianDays, count, result.days.data());
+    qFromLittleEndian<qint16>(startMinutes, count, result.startMinutes.data());
+    qFromLittleEndian<qint16>(endMinutes, count, result.endMinutes.data());
+
+    // 값 범위가 어긋난 파일은 통째로 거부 (색인이 지원 기간 밖을 넓히거나 잘못된 분이 급여에 들어가지 않도록)
+    const int invalidRow = findInvalidRow(result);
+    if (invalidRow >= 0) {
+        qCWarning(lcSnapshot) << "Binary snapshot has an out-of-range work log at row" << invalidRow << "in" << filename
+                              << "- day:" << result.days[invalidRow] << "start:" << result.startMinutes[invalidRow]
+                              << "end:" << result.endMinutes[invalidRow];
+        return false;
+    }
+
+    *contents = std::move(result);
+    return true;
+}
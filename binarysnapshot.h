@@ -0,0 +1,58 @@
+#ifndef BINARYSNAPSHOT_H
+#define BINARYSNAPSHOT_H
+
+#include <QList>
+#include <QVector>
+#include <QString>
+#include <functional>
+#include "employee.h"
+#include "worklog.h"
+
+// 버전이 있는 바이너리 스냅샷 파일을 읽고 쓰는 클래스
+//
+// 파일 구조 (모든 정수는 리틀 엔디언)
+//   [0]  헤더 64바이트: 매직 "SSUPAYB\0", 버전, nextEmployeeId, journalSequence,
+//        직원 수, 근무 기록 수, 직원 영역 위치/크기, 열(column) 영역 위치
+//   [64] 직원 영역: QDataStream으로 직렬화한 (id, 이름, 시급, 계좌) 목록
+//   [..] 열 영역 (8바이트 정렬): 근무 기록을 고정 폭 열로 저장
+//        qint32 employeeId[n], qint32 julianDay[n], qint16 startMinute[n], qint16 endMinute[n]
+//        (시간이 없으면 분 값은 -1, 날짜가 없으면 julianDay는 INT32_MIN)
+//        분은 -1 또는 0 ~ 1439, 날짜는 INT32_MIN 또는 WorkTimeIndex 지원 기간 안이어야 하며 아니면 읽기 실패
+//
+// 불러올 때는 파일을 메모리 매핑하고 열을 통째로 복사하므로 날짜/시간 파싱도, WorkLog 생성도 없음
+// DataManager가 쓴 파일은 직원 ID별로 묶여 있고 직원 안에서는 날짜순임 (다른 순서여도 읽을 수는 있음)
+// 시간은 분 단위로 저장되므로 초 값은 저장되지 않음 (초까지 필요하면 JSON 형식 사용)
+class BinarySnapshot
+{
+public:
+    static const quint32 FormatVersion = 1;
+
+    // 파일에서 읽어 온 스냅샷 내용
+    struct Contents {
+        int nextEmployeeId = 1;
+        qint64 journalSequence = 0;
+        QList<Employee> employees;
+        // 근무 기록 열 (파일 순서 그대로, 값 인코딩은 WorkLogColumns와 같음)
+        QVector<qint32> employeeIds;
+        QVector<qint32> days;
+        QVector<qint16> startMinutes;
+        QVector<qint16> endMinutes;
+    };
+
+    // 파일 앞부분이 바이너리 스냅샷 매직으로 시작하는지 확인
+    static bool isBinarySnapshot(const QString &filename);
+
+    static bool write(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                      const QList<Employee> &employees, const QList<WorkLog> &workLogs);
+
+    // 근무 기록을 메모리에 모으지 않고 쓰는 버전
+    // source는 호출될 때마다 같은 workLogCount개의 기록을 같은 순서로 visit에 넘겨야 함
+    // (열마다 한 번씩, 모두 네 번 호출됨. 개수가 다르면 실패)
+    using WorkLogVisitor = std::function<void(const WorkLog &)>;
+    using WorkLogSource = std::function<void(const WorkLogVisitor &visit)>;
+    static bool write(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                      const QList<Employee> &employees, qint64 workLogCount, const WorkLogSource &source);
+    static bool read(const QString &filename, Contents *contents);
+};
+
+#endif // BINARYSNAPSHOT_H
@@ -5,14 +5,20 @@
 #include <QDebug>
 #include <QLabel> // QLabel을 사용하므로 추가
 #include "worklog.h"
+#include "logging.h"
+#include "refreshscheduler.h"
+#include "tracing.h"
 #include <QVariant>
+#include <QHash>
 
 
 // 생성자: 달력 위젯의 초기 설정을 담당
 CalendarWidget::CalendarWidget(DataManager *dataManager, QWidget *parent) :
     QWidget(parent),
     ui(new Ui::CalendarWidget),
-    m_dataManager(dataManager)
+    m_dataManager(dataManager),
+    m_refreshScheduler(nullptr),
+    m_cellsRefreshTarget(-1)
 {
     ui->setupUi(this); // .ui 파일 로드
 
@@ -22,13 +28,21 @@ CalendarWidget::CalendarWidget(DataManager *dataManager, QWidget *parent) :
     connect(ui->btn_prev, &QPushButton::clicked, this, &CalendarWidget::showPreviousMonth);
     connect(ui->btn_next, &QPushButton::clicked, this, &CalendarWidget::showNextMonth);
 
-    // 5x7개의 모든 날짜 버튼을 찾아서 클릭 이벤트(onDayButtonClicked)와 연결
-    for (int row = 1; row <= 5; ++row) {
-        for (int col = 0; col < 7; ++col) {
-            QString buttonName = QString("btn_%1_%2").arg(row).arg(col);
-            QPushButton *dayButton = findChild<QPushButton*>(buttonName);
-            if (dayButton) {
-                connect(dayButton, &QPushButton::clicked, this, &CalendarWidget::onDayButtonClicked);
+    // 데이터 변경 알림 연결 (전체 데이터가 바뀐 경우에만 달력 전체를 다시 그림)
+    if (m_dataManager) {
+        connect(m_dataManager, &DataManager::workLogsChanged, this, &CalendarWidget::onWorkLogsChanged);
+        connect(m_dataManager, &DataManager::employeeUpdated, this, &CalendarWidget::onEmployeeUpdated);
+        connect(m_dataManager, &DataManager::employeeRemoved, this, &CalendarWidget::onEmployeeRemoved);
+        connect(m_dataManager, &DataManager::dataReset, this, &CalendarWidget::refreshDisplay);
+    }
+
+    // 6x7개의 날짜 라벨과 버튼을 한 번만 찾아서 저장하고, 버튼은 클릭 이벤트(onDayButtonClicked)와 연결
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < kColumns; ++col) {
+            m_dateLabels[row][col] = findChild<QLabel*>(QString("lbl_%1_%2").arg(row + 1).arg(col));
+            m_dayButtons[row][col] = findChild<QPushButton*>(QString("btn_%1_%2").arg(row + 1).arg(col));
+            if (m_dayButtons[row][col]) {
+                connect(m_dayButtons[row][col], &QPushButton::clicked, this, &CalendarWidget::onDayButtonClicked);
             }
         }
     }
@@ -40,11 +54,86 @@ CalendarWidget::~CalendarWidget()
     delete ui;
 }
 
+// 날짜 칸 갱신을 스케줄러 대상으로 등록 (달력 전체 갱신 대상보다 뒤에 등록되어야 같은 차례에 전체 갱신이 먼저 실행됨)
+void CalendarWidget::setRefreshScheduler(RefreshScheduler *scheduler)
+{
+    m_refreshScheduler = scheduler;
+    m_cellsRefreshTarget = scheduler ? scheduler->registerTarget("calendarCells", [this]() { flushDirtyCells(); }) : -1;
+}
+
+// logs[first, last) 구간(한 직원의 같은 날 근무 기록들)을 한 줄로 요약
+QString CalendarWidget::formatEmployeeDay(const QString &name, const QList<WorkLog> &logs, int first, int last)
+{
+    int dailyTotalMinutes = 0;
+    QTime earliestStart = QTime(23,59,59);
+    QTime latestEnd = QTime(0,0,0);
+    for (int i = first; i < last; ++i) {
+        const WorkLog &log = logs.at(i);
+        dailyTotalMinutes += log.getMinutesWorked();
+        if (log.getStartTime().isValid() && log.getStartTime() < earliestStart) earliestStart = log.getStartTime();
+        if (log.getEndTime().isValid() && log.getEndTime() > latestEnd) latestEnd = log.getEndTime();
+    }
+
+    if (dailyTotalMinutes <= 0) return QString();
+
+    return QString("%1: %2~%3 / %4")
+        .arg(name)
+        .arg(earliestStart.toString("HH:mm"))
+        .arg(latestEnd.toString("HH:mm"))
+        .arg(QString::number(dailyTotalMinutes / 60.0, 'f', 2) + "h");
+}
+
+QString CalendarWidget::formatDayCell(const QList<WorkLog> &dayLogs, const QHash<int, QString> &employeeNames)
+{
+    QStringList lines;
+    // 같은 날의 기록은 직원 순서대로 모여 있으므로 직원이 바뀌는 구간마다 한 줄씩 요약
+    int first = 0;
+    while (first < dayLogs.size()) {
+        const int employeeId = dayLogs.at(first).getEmployeeId();
+        int last = first + 1;
+        while (last < dayLogs.size() && dayLogs.at(last).getEmployeeId() == employeeId) ++last;
+
+        auto nameIt = employeeNames.constFind(employeeId);
+        if (nameIt != employeeNames.constEnd()) {
+            QString logEntry = formatEmployeeDay(nameIt.value(), dayLogs, first, last);
+            if (!logEntry.isEmpty()) lines.append(logEntry);
+        }
+        first = last;
+    }
+    return lines.join("\n");
+}
+
+QList<int> CalendarWidget::displayedEmployees(QHash<int, QString> *employeeNames) const
+{
+    QList<int> displayIds;
+    if (!m_dataManager) return displayIds;
+
+    for (int employeeId : m_checkedEmployeeIdsForDisplay) {
+        const Employee *emp = m_dataManager->findEmployee(employeeId);
+        if (!emp || emp->getName().isEmpty()) continue;
+        employeeNames->insert(employeeId, emp->getName());
+        displayIds.append(employeeId);
+    }
+    return displayIds;
+}
+
+QPushButton *CalendarWidget::dayButtonForDate(const QDate &date) const
+{
+    if (!date.isValid() || date.year() != currentDate.year() || date.month() != currentDate.month()) {
+        return nullptr;
+    }
+    // 첫 줄은 1일의 요일(월=0)부터 채워지므로 칸 번호 = 1일의 요일 오프셋 + (일 - 1)
+    const int firstColumn = QDate(date.year(), date.month(), 1).dayOfWeek() - 1;
+    const int cell = firstColumn + date.day() - 1;
+    return m_dayButtons[cell / kColumns][cell % kColumns];
+}
+
 
 // 달력의 모든 셀을 현재 데이터에 맞게 다시 그리는 핵심 함수
 void CalendarWidget::updateCalendar()
 {
-    qDebug() << "--- CalendarWidget::updateCalendar() CALLED for month:" << currentDate.toString("yyyy-MM") << "---";
+    TRACE_SCOPE("CalendarWidget::updateCalendar");
+    LOG_HOT(lcCalendar) << "updateCalendar for month:" << currentDate.year() << currentDate.month();
 
     ui->label_month->setText(currentDate.toString("yyyy년 M월")); // "YYYY년 M월" 텍스트 설정
 
@@ -53,20 +142,28 @@ void CalendarWidget::updateCalendar()
     int daysInMonth = currentDate.daysInMonth();      // 해당 월의 총 일수
     int currentDayDisplay = 1;
 
-    qDebug() << "Month Details: FirstDayOfWeek=" << startDayOfWeek << "DaysInMonth=" << daysInMonth;
+    LOG_HOT(lcCalendar) << "Month details: firstDayOfWeek" << startDayOfWeek << "daysInMonth" << daysInMonth;
+
+    m_dirtyDates.clear(); // 전체를 다시 그리므로 부분 갱신 대기 목록은 필요 없음
+
+    // 선택된 직원들의 이번 달 근무 기록을 한 번의 조회로 날짜별로 받아 둠
+    QVector<QList<WorkLog>> logsByDay;
+    QHash<int, QString> employeeNames; // 직원 이름도 직원당 한 번만 조회
+    const QList<int> displayIds = displayedEmployees(&employeeNames);
+    if (!displayIds.isEmpty()) {
+        logsByDay = m_dataManager->getWorkLogsByDayForMonth(displayIds, currentDate.year(), currentDate.month());
+    }
 
     // 6x7개의 모든 달력 셀을 순회
-    for (int row = 1; row <= 6; ++row) {
-        for (int col = 0; col < 7; ++col) {
-            QString dateTextLabelName = QString("lbl_%1_%2").arg(row).arg(col);
-            QLabel *dateTextLabel = this->findChild<QLabel *>(dateTextLabelName);
-            QString dayButtonName = QString("btn_%1_%2").arg(row).arg(col);
-            QPushButton *dayButton = this->findChild<QPushButton*>(dayButtonName);
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < kColumns; ++col) {
+            QLabel *dateTextLabel = m_dateLabels[row][col];
+            QPushButton *dayButton = m_dayButtons[row][col];
 
             if (!dateTextLabel && !dayButton) continue;
 
             // 현재 달에 속하지 않는 칸들을 비활성화하고 비움
-            if ((row == 1 && col < startDayOfWeek - 1) || currentDayDisplay > daysInMonth) {
+            if ((row == 0 && col < startDayOfWeek - 1) || currentDayDisplay > daysInMonth) {
                 // 비어있는 칸 처리 - 현재 달이 아닌 날짜들
                 if (dateTextLabel) dateTextLabel->setText("");
                 if (dayButton) {
@@ -87,58 +184,17 @@ void CalendarWidget::updateCalendar()
                     dayButton->setProperty("dateValue", cellDate);
                     dayButton->setStyleSheet("");
 
-                    QStringList logsDisplayForButton;
-
-                    // 표시하도록 선택된 직원이 있을 경우에만 실행
-                    if (m_dataManager && !m_checkedEmployeeIdsForDisplay.isEmpty()) {
-                        // 선택된 모든 직원에 대해 반복
-                        for (int employeeId : m_checkedEmployeeIdsForDisplay) {
-                            Employee emp = m_dataManager->getEmployeeById(employeeId);
-                            if (emp.getId() == -1 || emp.getName().isEmpty()) continue;
-
-                            // 해당 직원의 해당 날짜 근무 기록을 데이터 관리자로부터 가져옴
-                            QList<WorkLog> logs = m_dataManager->getWorkLogsForEmployeeOnDate(employeeId, cellDate);
-                            if (logs.isEmpty()) continue;
-
-                            // 근무 기록들을 요약하여 하나의 문자열로 만듦
-                            // ... (요약 로직) ...
-                            double dailyTotalHoursForEmp = 0;
-                            QTime earliestStartForEmp = QTime(23,59,59);
-                            QTime latestEndForEmp = QTime(0,0,0);
-                            bool workedThisDay = false;
-                            for(const WorkLog& log : logs) {
-                                dailyTotalHoursForEmp += log.getHoursWorked();
-                                if(log.getStartTime().isValid() && log.getStartTime() < earliestStartForEmp) earliestStartForEmp = log.getStartTime();
-                                if(log.getEndTime().isValid() && log.getEndTime() > latestEndForEmp) latestEndForEmp = log.getEndTime();
-                                workedThisDay = true;
-                            }
-
-
-                            if (workedThisDay && dailyTotalHoursForEmp > 0) {
-                                QString startTimeStr = earliestStartForEmp.toString("HH:mm");
-                                QString endTimeStr = latestEndForEmp.toString("HH:mm");
-                                QString totalHoursStr = QString::number(dailyTotalHoursForEmp, 'f', 2) + "h";
-
-                                QString logEntry = QString("%1: %2~%3 / %4")
-                                                       .arg(emp.getName())
-                                                       .arg(startTimeStr)
-                                                       .arg(endTimeStr)
-                                                       .arg(totalHoursStr);
-                                logsDisplayForButton.append(logEntry);
-                            }
-                        }
-                    }
                     // 요약된 모든 근무 기록 텍스트를 버튼에 표시
-                    QString buttonDisplayText = logsDisplayForButton.join("\n");
-                    dayButton->setText(buttonDisplayText);
-                    if (buttonDisplayText.isEmpty()) { dayButton->setStyleSheet(""); }
+                    if (currentDayDisplay - 1 < logsByDay.size()) {
+                        dayButton->setText(formatDayCell(logsByDay.at(currentDayDisplay - 1), employeeNames));
+                    } else {
+                        dayButton->setText("");
+                    }
                 }
                 currentDayDisplay++;
             }
         }
     }
-    qDebug() << "--- CalendarWidget::updateCalendar() FINISHED ---";
-
 }
 
 // '이전 달' 버튼 클릭 시
@@ -174,53 +230,78 @@ void CalendarWidget::onDayButtonClicked()
     }
 }
 
-// calendarwidget.cpp 에 추가
-
-void CalendarWidget::updateDayCellDisplay(const QDate &date, int employeeIndex)
+// 특정 직원의 특정 날짜 기록이 바뀌었을 때: 그 날짜 칸을 다시 그릴 목록에 넣고 스케줄러에 반영을 예약
+void CalendarWidget::updateDayCellDisplay(const QDate &date, int employeeId)
 {
-    if (!m_dataManager || !date.isValid() || employeeIndex < 0) {
-        return;
+    if (!m_dataManager || !m_checkedEmployeeIdsForDisplay.contains(employeeId)) return; // 화면에 없는 직원
+    if (!dayButtonForDate(date)) return; // 지금 보이는 달이 아님
+
+    m_dirtyDates.insert(date);
+    if (m_refreshScheduler) {
+        m_refreshScheduler->invalidate(m_cellsRefreshTarget);
+    } else {
+        flushDirtyCells();
     }
+}
 
-    QPushButton *targetButton = nullptr;
-    // 특정 날짜에 해당하는 버튼을 찾음
-    for (int r = 1; r <= 6; ++r) {
-        for (int c = 0; c < 7; ++c) {
-            QString btnName = QString("btn_%1_%2").arg(r).arg(c);
-            QPushButton *btn = findChild<QPushButton*>(btnName);
-            if (btn) {
-                QVariant dateProp = btn->property("dateValue");
-                if (dateProp.isValid() && dateProp.toDate() == date) {
-                    targetButton = btn;
-                    break;
-                }
-            }
+// 표시해 둔 날짜 칸들만 전체 갱신과 같은 형식으로 다시 그림
+void CalendarWidget::flushDirtyCells()
+{
+    TRACE_SCOPE("CalendarWidget::flushDirtyCells");
+    if (m_dirtyDates.isEmpty()) return;
+
+    QHash<int, QString> employeeNames;
+    const QList<int> displayIds = displayedEmployees(&employeeNames);
+
+    for (const QDate &date : std::as_const(m_dirtyDates)) {
+        QPushButton *dayButton = dayButtonForDate(date);
+        if (!dayButton) continue; // 그 사이 달이 바뀜
+
+        QList<WorkLog> dayLogs;
+        for (int employeeId : displayIds) {
+            dayLogs.append(m_dataManager->getWorkLogsForEmployeeOnDate(employeeId, date));
         }
-        if (targetButton) break;
+        dayButton->setText(formatDayCell(dayLogs, employeeNames));
+    }
+    m_dirtyDates.clear();
+}
+
+// 근무 기록이 바뀐 기간 중 지금 보이는 달에 속한 날짜 칸만 갱신 대상으로 표시
+void CalendarWidget::onWorkLogsChanged(int employeeId, const QDate &fromDate, const QDate &toDate)
+{
+    if (!m_checkedEmployeeIdsForDisplay.contains(employeeId) || !fromDate.isValid() || !toDate.isValid()) return;
+
+    QDate firstDayOfMonth(currentDate.year(), currentDate.month(), 1);
+    QDate lastDayOfMonth(currentDate.year(), currentDate.month(), currentDate.daysInMonth());
+    QDate from = qMax(fromDate, firstDayOfMonth);
+    QDate to = qMin(toDate, lastDayOfMonth);
+    for (QDate date = from; date <= to; date = date.addDays(1)) {
+        updateDayCellDisplay(date, employeeId);
     }
+}
 
-    // 찾은 버튼의 텍스트를 근무 시간으로 업데이트
-    if (targetButton) {
-        QList<WorkLog> logs = m_dataManager->getWorkLogsForEmployeeOnDate(employeeIndex, date);
-        double totalHours = 0;
-        for (const WorkLog &log : logs) {
-            totalHours += log.getHoursWorked(); // WorkLog의 getHoursWorked() 사용
-        }
-        if (totalHours > 0) {
-            targetButton->setText(QString("%1h").arg(totalHours));
-        } else {
-            targetButton->setText("");
-        }
+// 표시 중인 직원의 이름이 바뀌면 모든 칸의 텍스트가 달라지므로 전체를 다시 그림
+void CalendarWidget::onEmployeeUpdated(int employeeId)
+{
+    if (m_checkedEmployeeIdsForDisplay.contains(employeeId)) {
+        updateCalendar();
+    }
+}
+
+// 삭제된 직원은 표시 목록에서 빼고, 표시 중이었다면 다시 그림
+void CalendarWidget::onEmployeeRemoved(int employeeId)
+{
+    if (m_checkedEmployeeIdsForDisplay.removeAll(employeeId) > 0) {
+        updateCalendar();
     }
 }
 
 // 달력에 표시할 직원 ID 목록을 설정하는 함수
 void CalendarWidget::setCheckedEmployeesForDisplay(const QList<int>& checkedIds)
 {
-    qDebug() << "==> CalendarWidget::setCheckedEmployeesForDisplay - Setting IDs:" << checkedIds;
+    LOG_HOT(lcCalendar) << "Checked employees for display:" << checkedIds;
     // 이 목록은 updateCalendar 함수에서 사용됨
     m_checkedEmployeeIdsForDisplay = checkedIds;
-    qDebug() << "    CalendarWidget: m_checkedEmployeeIdsForDisplay is NOW:" << m_checkedEmployeeIdsForDisplay;
 }
 
 // 달력 표시를 새로고침하는 외부 호출용 함수
@@ -4,9 +4,13 @@
 #include <QWidget>
 #include <QDate>
 #include <QList>
+#include <QHash>
+#include <QSet>
 #include "datamanager.h"
 
 class QPushButton;
+class QLabel;
+class RefreshScheduler;
 
 namespace Ui {
 class CalendarWidget;
@@ -21,9 +25,13 @@ public:
     explicit CalendarWidget(DataManager *dataManager, QWidget *parent = nullptr);
     ~CalendarWidget();
 
+    // 한 직원의 한 날짜 근무 기록이 바뀌었을 때 호출: 그 날짜 칸만 다시 그리도록 표시해 둠
+    // 같은 이벤트 루프 차례에 들어온 변경은 모아서 갱신 스케줄러의 "calendarCells" 대상으로 한 번에 반영됨
     void updateDayCellDisplay(const QDate &date, int employeeId);
     // 달력 UI를 최신 데이터로 새로고침
     void updateCalendar();
+    // 날짜 칸 부분 갱신을 맡길 스케줄러 설정 (설정 전에는 표시하는 즉시 다시 그림)
+    void setRefreshScheduler(RefreshScheduler *scheduler);
 
     // 달력에 표시할 직원 목록을 설정
     void setCheckedEmployeesForDisplay(const QList<int>& checkedIds);
@@ -41,12 +49,35 @@ private slots:
     void showNextMonth();
     // 달력의 날짜(버튼)를 클릭했을 때 실행
     void onDayButtonClicked();
+    // DataManager 변경 알림: 바뀐 직원/날짜에 해당하는 칸만 다시 그림
+    void onWorkLogsChanged(int employeeId, const QDate &fromDate, const QDate &toDate);
+    void onEmployeeUpdated(int employeeId);
+    void onEmployeeRemoved(int employeeId);
 
 private:
+    // 달력 칸 배열 크기 (6주 x 7일). .ui의 lbl_/btn_ 이름은 행이 1부터 시작
+    static constexpr int kRows = 6;
+    static constexpr int kColumns = 7;
+
+    // 한 직원의 하루 근무 기록을 "이름: 시작~끝 / 시간h" 형태로 요약 (근무가 없으면 빈 문자열)
+    static QString formatEmployeeDay(const QString &name, const QList<WorkLog> &logs, int first, int last);
+    // 하루치 근무 기록(직원 순서대로 모여 있음)으로 날짜 버튼 텍스트를 만듦 - 전체/부분 갱신 공용
+    static QString formatDayCell(const QList<WorkLog> &dayLogs, const QHash<int, QString> &employeeNames);
+    // 표시할 직원 중 이름이 있는 직원의 ID(표시 순서)와 이름을 한 번에 조회
+    QList<int> displayedEmployees(QHash<int, QString> *employeeNames) const;
+    // 현재 달의 날짜에 해당하는 버튼 (다른 달이면 nullptr) - 요일 오프셋 계산으로 O(1)
+    QPushButton *dayButtonForDate(const QDate &date) const;
+    void flushDirtyCells(); // 표시해 둔 날짜 칸들만 다시 그림
+
     Ui::CalendarWidget *ui; // UI 요소 관리 포인터
+    QLabel *m_dateLabels[kRows][kColumns];      // 생성자에서 한 번만 찾아 둔 날짜 라벨
+    QPushButton *m_dayButtons[kRows][kColumns]; // 생성자에서 한 번만 찾아 둔 날짜 버튼
     QDate currentDate; // 현재 달력이 보여주는 기준 날짜
     DataManager *m_dataManager; // 데이터 관리자 포인터
     QList<int> m_checkedEmployeeIdsForDisplay; // 화면에 표시할 직원 ID 목록
+    QSet<QDate> m_dirtyDates; // 다시 그려야 하는 날짜 칸
+    RefreshScheduler *m_refreshScheduler; // 날짜 칸 갱신을 예약할 스케줄러 (없으면 바로 갱신)
+    int m_cellsRefreshTarget;             // 스케줄러의 "calendarCells" 대상 번호
 };
 
 #endif // CALENDARWIDGET_H
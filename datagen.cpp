@@ -0,0 +1,257 @@
+// 규모 시험용 합성 데이터 생성기 (cpp_project_datagen)
+// 실제 직원 정보 없이 운영 규모의 저장 파일(JSON 또는 바이너리 스냅샷)을 만듦
+// 같은 설정과 시드면 결과 파일은 바이트 단위로 항상 같음 (플랫폼별 난수 분포 구현에 의존하지 않음)
+// 근무 기록은 만들면서 바로 파일에 쓰므로 천만 건 이상도 메모리에 모으지 않음
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QDebug>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include "binarysnapshot.h"
+#include "employee.h"
+#include "worklog.h"
+
+namespace {
+// splitmix64: 작고 빠르며 어느 플랫폼에서나 같은 수열을 내는 난수 생성기
+class SplitMix64
+{
+public:
+    explicit SplitMix64(quint64 seed) : m_state(seed) {}
+
+    quint64 next()
+    {
+        quint64 z = (m_state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    // [0, bound) 정수 (상위 32비트 곱셈, 분포 편향은 무시할 수준)
+    int uniform(int bound) { return int(((next() >> 32) * quint64(bound)) >> 32); }
+    // [0, 1) 실수
+    double unit() { return double(next() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+    quint64 m_state;
+};
+
+struct Settings {
+    int employeeCount = 50;
+    int years = 1;
+    int shiftsPerWeek = 5;
+    double overnightFraction = 0.1;
+    quint64 seed = 1;
+    QDate startDate = QDate(2020, 1, 6); // 월요일로 맞춤
+};
+
+// 근무 기록 한 건 (율리우스 일, 자정부터의 분)
+struct Shift {
+    int employeeId;
+    qint64 julianDay;
+    int startMinute;
+    int endMinute;
+};
+
+class SyntheticData
+{
+public:
+    explicit SyntheticData(const Settings &settings) : m_settings(settings) {}
+
+    int weekCount() const { return m_settings.years * 52; }
+    int shiftsPerWeek() const { return qBound(0, m_settings.shiftsPerWeek, 7); }
+    qint64 shiftCount() const { return qint64(m_settings.employeeCount) * weekCount() * shiftsPerWeek(); }
+
+    QList<Employee> employees() const
+    {
+        SplitMix64 rng(m_settings.seed);
+        QList<Employee> result;
+        result.reserve(m_settings.employeeCount);
+        for (int i = 1; i <= m_settings.employeeCount; ++i) {
+            const int wage = 9860 + 10 * rng.uniform(515); // 9,860원 ~ 15,000원
+            result.append(Employee(i, QString("직원%1").arg(i, 5, 10, QChar('0')), wage,
+                                   QString("000-00-%1").arg(i, 6, 10, QChar('0'))));
+        }
+        return result;
+    }
+
+    // 근무 기록을 날짜순(주 → 직원 → 요일)으로 visit에 넘김. 호출할 때마다 같은 순서를 재생함
+    void forEachShift(const std::function<void(const Shift &)> &visit) const
+    {
+        SplitMix64 rng(m_settings.seed ^ 0x5DEECE66DULL);
+        const qint64 firstDay = m_settings.startDate.toJulianDay();
+        const int perWeek = shiftsPerWeek();
+        for (int week = 0; week < weekCount(); ++week) {
+            for (int employeeId = 1; employeeId <= m_settings.employeeCount; ++employeeId) {
+                // 7개 요일 중 perWeek개를 겹치지 않게 고른 뒤 요일 순으로 정렬
+                int days[7] = {0, 1, 2, 3, 4, 5, 6};
+                for (int i = 0; i < perWeek; ++i) {
+                    std::swap(days[i], days[i + rng.uniform(7 - i)]);
+                }
+                std::sort(days, days + perWeek);
+
+                for (int i = 0; i < perWeek; ++i) {
+                    Shift shift;
+                    shift.employeeId = employeeId;
+                    shift.julianDay = firstDay + week * 7 + days[i];
+                    int length;
+                    if (rng.unit() < m_settings.overnightFraction) {
+                        shift.startMinute = 20 * 60 + 30 * rng.uniform(8); // 20:00 ~ 23:30 시작, 다음 날 퇴근
+                        length = 6 * 60 + 30 * rng.uniform(9);
+                    } else {
+                        shift.startMinute = 6 * 60 + 30 * rng.uniform(17); // 06:00 ~ 14:00 시작, 당일 퇴근
+                        length = 3 * 60 + 30 * rng.uniform(13);
+                    }
+                    shift.endMinute = (shift.startMinute + length) % (24 * 60);
+                    visit(shift);
+                }
+            }
+        }
+    }
+
+private:
+    Settings m_settings;
+};
+
+WorkLog toWorkLog(const Shift &shift)
+{
+    return WorkLog(shift.employeeId, QDate::fromJulianDay(shift.julianDay),
+                   QTime(shift.startMinute / 60, shift.startMinute % 60),
+                   QTime(shift.endMinute / 60, shift.endMinute % 60));
+}
+
+// DataManager의 JSON 스냅샷과 같은 구조로 씀 (한 줄짜리 JSON, 근무 기록은 한 건씩 바로 기록)
+bool writeJson(const QString &filename, const SyntheticData &data)
+{
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Couldn't open" << filename << "for writing:" << file.errorString();
+        return false;
+    }
+
+    const QList<Employee> employees = data.employees();
+    QByteArray chunk;
+    chunk += "{\"nextEmployeeId\":" + QByteArray::number(employees.size() + 1) + ",\"journalSequence\":0,\"employees\":[";
+    for (int i = 0; i < employees.size(); ++i) {
+        if (i > 0) chunk += ',';
+        chunk += QJsonDocument(employees.at(i).toJson()).toJson(QJsonDocument::Compact);
+    }
+    chunk += "],\"worklogs\":[";
+
+    // 날짜 문자열은 날이 바뀔 때만 다시 만듦
+    qint64 cachedDay = -1;
+    char dateText[16] = {};
+    bool first = true;
+    data.forEachShift([&](const Shift &shift) {
+        if (shift.julianDay != cachedDay) {
+            const QDate date = QDate::fromJulianDay(shift.julianDay);
+            std::snprintf(dateText, sizeof(dateText), "%04d-%02d-%02d", date.year(), date.month(), date.day());
+            cachedDay = shift.julianDay;
+        }
+        char record[128];
+        const int length = std::snprintf(record, sizeof(record),
+                                         "%s{\"date\":\"%s\",\"employeeId\":%d,\"endTime\":\"%02d:%02d:00\",\"startTime\":\"%02d:%02d:00\"}",
+                                         first ? "" : ",", dateText, shift.employeeId,
+                                         shift.endMinute / 60, shift.endMinute % 60,
+                                         shift.startMinute / 60, shift.startMinute % 60);
+        chunk.append(record, length);
+        first = false;
+        if (chunk.size() >= (1 << 20)) {
+            file.write(chunk);
+            chunk.clear();
+        }
+    });
+    chunk += "]}\n";
+    file.write(chunk);
+
+    if (!file.commit()) {
+        qWarning() << "Failed to write" << filename << ":" << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+bool writeBinary(const QString &filename, const SyntheticData &data)
+{
+    const QList<Employee> employees = data.employees();
+    return BinarySnapshot::write(filename, employees.size() + 1, 0, employees, data.shiftCount(),
+                                 [&data](const BinarySnapshot::WorkLogVisitor &visit) {
+                                     data.forEachShift([&visit](const Shift &shift) { visit(toWorkLog(shift)); });
+                                 });
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("cpp_project_datagen");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("규모 시험용 합성 저장 파일을 만듭니다.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("output", "만들 파일 (.json이면 JSON, 그 외에는 바이너리 스냅샷)");
+    const QCommandLineOption formatOption("format", "출력 형식: json 또는 binary (기본: 확장자로 결정)", "format");
+    const QCommandLineOption employeesOption("employees", "직원 수 (기본: 50)", "count", "50");
+    const QCommandLineOption yearsOption("years", "근무 기록 기간 (년, 기본: 1)", "years", "1");
+    const QCommandLineOption shiftsOption("shifts-per-week", "직원별 주당 근무 횟수 0~7 (기본: 5)", "count", "5");
+    const QCommandLineOption overnightOption("overnight-fraction", "자정을 넘기는 근무 비율 0~1 (기본: 0.1)", "fraction", "0.1");
+    const QCommandLineOption seedOption("seed", "난수 시드 (기본: 1)", "seed", "1");
+    const QCommandLineOption startOption("start-date", "첫 주 (그 주 월요일로 맞춤, 기본: 2020-01-06)", "yyyy-MM-dd", "2020-01-06");
+    parser.addOptions({formatOption, employeesOption, yearsOption, shiftsOption, overnightOption, seedOption, startOption});
+    parser.process(app);
+
+    if (parser.positionalArguments().size() != 1) {
+        parser.showHelp(1);
+    }
+    const QString outputPath = parser.positionalArguments().first();
+
+    Settings settings;
+    bool ok = true;
+    bool valid = true;
+    settings.employeeCount = parser.value(employeesOption).toInt(&ok);
+    valid = valid && ok && settings.employeeCount >= 0;
+    settings.years = parser.value(yearsOption).toInt(&ok);
+    valid = valid && ok && settings.years >= 0;
+    settings.shiftsPerWeek = parser.value(shiftsOption).toInt(&ok);
+    valid = valid && ok && settings.shiftsPerWeek >= 0 && settings.shiftsPerWeek <= 7;
+    settings.overnightFraction = parser.value(overnightOption).toDouble(&ok);
+    valid = valid && ok && settings.overnightFraction >= 0.0 && settings.overnightFraction <= 1.0;
+    settings.seed = parser.value(seedOption).toULongLong(&ok);
+    valid = valid && ok;
+    const QDate startDate = QDate::fromString(parser.value(startOption), Qt::ISODate);
+    valid = valid && startDate.isValid();
+    if (!valid) {
+        qWarning("Invalid generator settings. See --help.");
+        return 1;
+    }
+    settings.startDate = startDate.addDays(1 - startDate.dayOfWeek());
+
+    QString format = parser.value(formatOption).toLower();
+    if (format.isEmpty()) {
+        format = QFileInfo(outputPath).suffix().compare("json", Qt::CaseInsensitive) == 0 ? "json" : "binary";
+    }
+    if (format != "json" && format != "binary") {
+        qWarning() << "Unknown output format:" << format;
+        return 1;
+    }
+
+    const SyntheticData data(settings);
+    if (format == "binary" && data.shiftCount() > std::numeric_limits<int>::max()) {
+        qWarning() << "Too many work logs for a binary snapshot:" << data.shiftCount();
+        return 1;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const bool written = (format == "json") ? writeJson(outputPath, data) : writeBinary(outputPath, data);
+    if (!written) return 1;
+
+    fprintf(stderr, "Wrote %s (%s): %d employees, %lld work logs in %lld ms\n", qPrintable(outputPath),
+            qPrintable(format), settings.employeeCount, static_cast<long long>(data.shiftCount()),
+            static_cast<long long>(timer.elapsed()));
+    return 0;
+}
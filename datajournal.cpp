@@ -0,0 +1,175 @@
+#include "datajournal.h"
+#include "logging.h"
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QDebug>
+
+DataJournal::DataJournal() : m_lastSequence(0), m_pendingRecords(0)
+{
+}
+
+DataJournal::~DataJournal()
+{
+    close();
+}
+
+QString DataJournal::journalPathFor(const QString &snapshotPath)
+{
+    return snapshotPath + ".journal";
+}
+
+QString DataJournal::rotatedJournalPathFor(const QString &snapshotPath)
+{
+    return snapshotPath + ".journal.old";
+}
+
+QString DataJournal::journalPath() const
+{
+    return journalPathFor(m_snapshotPath);
+}
+
+QString DataJournal::rotatedJournalPath() const
+{
+    return rotatedJournalPathFor(m_snapshotPath);
+}
+
+bool DataJournal::open(const QString &snapshotPath)
+{
+    close();
+    m_snapshotPath = snapshotPath;
+
+    // 이전 실행이 레코드를 쓰다 죽었으면 마지막 줄이 잘려 있음 - 새 레코드가 거기에 붙지 않도록 줄을 끊어 둠
+    bool needsNewline = false;
+    QFile existing(journalPath());
+    if (existing.size() > 0 && existing.open(QIODevice::ReadOnly)) {
+        existing.seek(existing.size() - 1);
+        char lastChar = '\n';
+        needsNewline = existing.getChar(&lastChar) && lastChar != '\n';
+        existing.close();
+    }
+
+    m_file.setFileName(journalPath());
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(lcJournal) << "Couldn't open journal file" << m_file.fileName() << ":" << m_file.errorString();
+        return false;
+    }
+    if (needsNewline) {
+        m_file.write("\n");
+        m_file.flush();
+    }
+    m_pendingRecords = 0;
+    return true;
+}
+
+void DataJournal::close()
+{
+    if (m_file.isOpen()) {
+        m_file.flush();
+        m_file.close();
+    }
+}
+
+bool DataJournal::isOpen() const
+{
+    return m_file.isOpen();
+}
+
+bool DataJournal::append(QJsonObject record)
+{
+    if (!m_file.isOpen()) return false;
+
+    record["seq"] = ++m_lastSequence;
+    QByteArray line = QJsonDocument(record).toJson(QJsonDocument::Compact);
+    line.append('\n');
+
+    if (m_file.write(line) != line.size() || !m_file.flush()) {
+        qCCritical(lcJournal) << "Failed to append journal record:" << m_file.errorString();
+        return false;
+    }
+    ++m_pendingRecords;
+    return true;
+}
+
+qint64 DataJournal::lastSequence() const
+{
+    return m_lastSequence;
+}
+
+void DataJournal::setLastSequence(qint64 sequence)
+{
+    m_lastSequence = sequence;
+}
+
+int DataJournal::pendingRecordCount() const
+{
+    return m_pendingRecords;
+}
+
+void DataJournal::setPendingRecordCount(int count)
+{
+    m_pendingRecords = count;
+}
+
+bool DataJournal::rotate()
+{
+    if (!m_file.isOpen()) return false;
+    m_file.close();
+
+    const QString activePath = journalPath();
+    const QString rotatedPath = rotatedJournalPath();
+
+    bool moved = false;
+    if (!QFile::exists(rotatedPath)) {
+        moved = QFile::rename(activePath, rotatedPath);
+    } else {
+        // 이전 압축이 끝나지 못한 경우: 남은 .old 뒤에 현재 저널 내용을 이어 붙임
+        QFile active(activePath);
+        QFile rotated(rotatedPath);
+        if (active.open(QIODevice::ReadOnly) && rotated.open(QIODevice::WriteOnly | QIODevice::Append)) {
+            moved = rotated.write(active.readAll()) >= 0 && rotated.flush();
+            active.close();
+            rotated.close();
+            if (moved) {
+                moved = QFile::remove(activePath);
+            }
+        }
+    }
+
+    if (!moved) {
+        qCWarning(lcJournal) << "Failed to rotate journal" << activePath;
+    }
+    // 회전 성공 여부와 상관없이 활성 저널은 다시 열어 둠 (기록이 끊기지 않도록)
+    m_file.setFileName(activePath);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(lcJournal) << "Couldn't reopen journal file" << activePath << ":" << m_file.errorString();
+        return false;
+    }
+    if (moved) {
+        m_pendingRecords = 0;
+    }
+    return moved;
+}
+
+QList<QJsonObject> DataJournal::readRecords(const QString &path)
+{
+    QList<QJsonObject> records;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return records; // 저널이 없으면 재생할 내용도 없음
+    }
+
+    while (!file.atEnd()) {
+        QByteArray line = file.readLine().trimmed();
+        if (line.isEmpty()) continue;
+
+        QJsonParseError error;
+        QJsonDocument doc = QJsonDocument::fromJson(line, &error);
+        if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+            // 기록 도중 프로세스가 종료되어 잘린 줄 - 해당 레코드만 건너뜀
+            qCWarning(lcJournal) << "Journal" << path << "has a truncated record; skipping it.";
+            continue;
+        }
+        records.append(doc.object());
+    }
+    return records;
+}
@@ -0,0 +1,52 @@
+#ifndef DATAJOURNAL_H
+#define DATAJOURNAL_H
+
+#include <QFile>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+// 스냅샷 파일 옆에 변경 내역을 한 줄씩 덧붙이는 쓰기 전 기록(write-ahead journal) 클래스
+// - 활성 저널: <스냅샷 경로>.journal
+// - 압축(compaction) 중인 저널: <스냅샷 경로>.journal.old (스냅샷 저장이 끝나면 삭제됨)
+// 각 레코드는 한 줄짜리 JSON이며 "seq"(증가하는 순번)와 "op"(작업 종류)를 가짐
+class DataJournal
+{
+public:
+    DataJournal();
+    ~DataJournal();
+
+    // 스냅샷 경로를 기준으로 활성 저널 파일을 덧붙이기 모드로 엶
+    bool open(const QString &snapshotPath);
+    void close();
+    bool isOpen() const;
+
+    // 레코드에 다음 순번을 붙여 한 줄로 기록하고 바로 flush (프로세스가 죽어도 남도록)
+    bool append(QJsonObject record);
+
+    qint64 lastSequence() const; // 마지막으로 부여한 순번
+    void setLastSequence(qint64 sequence);
+    int pendingRecordCount() const; // 마지막 회전(rotate) 이후 활성 저널에 쌓인 레코드 수
+    // 아직 스냅샷에 반영되지 않은 레코드 수를 지정 (open은 0으로 시작하므로, 다시 연 뒤 재생한 레코드 수로 채움)
+    void setPendingRecordCount(int count);
+
+    // 활성 저널을 압축용 파일(.journal.old)로 넘기고 빈 저널을 새로 엶
+    // 이전 압축이 실패해서 .journal.old가 남아 있으면 그 뒤에 이어 붙임
+    bool rotate();
+
+    QString journalPath() const;
+    QString rotatedJournalPath() const;
+    static QString journalPathFor(const QString &snapshotPath);
+    static QString rotatedJournalPathFor(const QString &snapshotPath);
+
+    // 저널 파일의 레코드들을 순서대로 읽음 (쓰다 만 채로 잘린 줄은 건너뜀)
+    static QList<QJsonObject> readRecords(const QString &path);
+
+private:
+    QFile m_file;           // 활성 저널 파일
+    QString m_snapshotPath; // 기준 스냅샷 경로
+    qint64 m_lastSequence;  // 마지막 레코드 순번
+    int m_pendingRecords;   // 회전 이후 쌓인 레코드 수
+};
+
+#endif // DATAJOURNAL_H
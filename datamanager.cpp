@@ -3,12 +3,68 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QSaveFile>
+#include <QStringList>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QFileInfo>
 #include <QDebug>
-#include <algorithm> // std::max 사용을 위해 (loadData에서)
+#include <QSignalBlocker>
+#include <QSet>
+#include "binarysnapshot.h"
+#include "jsonstreamreader.h"
+#include "logging.h"
+#include "tracing.h"
+#include <algorithm> // std::sort, std::for_each 등 색인 처리용
 
-DataManager::DataManager() : m_nextEmployeeId(1) // m_nextEmployeeId를 1로 초기화
+namespace {
+// 날짜가 없는 기록(화면에서 날짜 없이 만든 기록 등)은 색인에 들어가지 않으므로 그대로 받아들임
+bool isWorkLogDateSupported(const QDate &date)
 {
+    return !date.isValid() || WorkTimeIndex::isSupportedDay(date.toJulianDay());
+}
 
+// 근무 기록 열은 분 단위로 저장하므로 (WorkLogColumns 참고) 초가 있는 시각은 저장할 때 잘림
+bool hasSeconds(const QTime &time)
+{
+    return time.isValid() && (time.second() != 0 || time.msec() != 0);
+}
+
+bool hasSeconds(const WorkLog &log)
+{
+    return hasSeconds(log.getStartTime()) || hasSeconds(log.getEndTime());
+}
+}
+
+DataManager::DataManager(QObject *parent)
+    : QObject(parent)
+    , m_workLogCacheValid(true)
+    , m_nextEmployeeId(1) // m_nextEmployeeId를 1로 초기화
+    , m_snapshotSequence(0)
+{
+
+}
+
+DataManager::~DataManager()
+{
+    closeStore();
+}
+
+// --- 근무 기록 색인 헬퍼 함수들 ---
+// 같은 날짜의 기존 기록들 뒤에 삽입해서 입력 순서를 유지 (첫 번째 기록 조회 결과가 예전과 같도록)
+void DataManager::insertWorkLogIntoIndex(const WorkLog &log)
+{
+    WorkLogColumns &columns = m_workLogsByEmployee[log.getEmployeeId()];
+    const int row = columns.insertSorted(log);
+    m_workTimeByEmployee[log.getEmployeeId()].apply(columns, row, 1); // 분 단위로 저장된 값 기준
+    invalidateWorkLogCache();
+}
+
+void DataManager::invalidateWorkLogCache()
+{
+    m_workLogCacheValid = false;
 }
 
 // Employee 객체를 받아서 ID와 색상을 할당하고 리스트에 추가
@@ -21,6 +77,21 @@ void DataManager::addEmployee(Employee &employee) // Employee&로 변경
 
 
     m_employees.append(employee); // ID와 색상이 설정된 직원 객체를 리스트에 추가
+    m_employeeSlotById.insert(employee.getId(), m_employees.size() - 1);
+    appendJournal(QJsonObject{{"op", "addEmployee"}, {"employee", employee.toJson()}});
+    emit employeeAdded(employee.getId());
+}
+
+// 직원 목록이 앞당겨지거나 새로 채워졌을 때 fromSlot부터의 위치 색인을 다시 기록
+void DataManager::rebuildEmployeeSlots(int fromSlot)
+{
+    if (fromSlot == 0) {
+        m_employeeSlotById.clear();
+        m_employeeSlotById.reserve(m_employees.size());
+    }
+    for (int i = fromSlot; i < m_employees.size(); ++i) {
+        m_employeeSlotById.insert(m_employees.at(i).getId(), i);
+    }
 }
 
 const QList<Employee>& DataManager::getEmployees() const
@@ -28,127 +99,249 @@ const QList<Employee>& DataManager::getEmployees() const
     return m_employees;
 }
 
+const Employee* DataManager::findEmployee(int employeeId) const
+{
+    auto slotIt = m_employeeSlotById.constFind(employeeId);
+    if (slotIt == m_employeeSlotById.constEnd()) {
+        return nullptr;
+    }
+    return &m_employees.at(slotIt.value());
+}
+
 Employee DataManager::getEmployeeById(int employeeId) const
 {
-    for (const Employee &emp : m_employees) {
-        if (emp.getId() == employeeId) {
-            return emp;
-        }
+    if (const Employee *emp = findEmployee(employeeId)) {
+        return *emp;
     }
-    qWarning() << "Employee with ID" << employeeId << "not found.";
+    qCWarning(lcData) << "Employee with ID" << employeeId << "not found.";
     return Employee(); // ID가 -1인 기본 Employee 객체 반환
 }
 
 bool DataManager::updateEmployeeById(int employeeId, const Employee &updatedEmployeeInfo)
 {
-    for (int i = 0; i < m_employees.size(); ++i) {
-        if (m_employees[i].getId() == employeeId) {
-            // ID는 변경하지 않고, 다른 정보만 업데이트
-            // updatedEmployeeInfo에도 ID가 있겠지만, employeeId 파라미터로 찾은 객체를 수정
-            m_employees[i].setName(updatedEmployeeInfo.getName());
-            m_employees[i].setHourlyWage(updatedEmployeeInfo.getHourlyWage());
-            m_employees[i].setBankAccount(updatedEmployeeInfo.getBankAccount());
-            qDebug() << "Employee with ID" << employeeId << "updated.";
-            return true;
-        }
+    auto slotIt = m_employeeSlotById.constFind(employeeId);
+    if (slotIt != m_employeeSlotById.constEnd()) {
+        // ID는 변경하지 않고, 다른 정보만 업데이트
+        // updatedEmployeeInfo에도 ID가 있겠지만, employeeId 파라미터로 찾은 객체를 수정
+        Employee &emp = m_employees[slotIt.value()];
+        emp.setName(updatedEmployeeInfo.getName());
+        emp.setHourlyWage(updatedEmployeeInfo.getHourlyWage());
+        emp.setBankAccount(updatedEmployeeInfo.getBankAccount());
+        appendJournal(QJsonObject{{"op", "updateEmployee"}, {"id", employeeId}, {"employee", emp.toJson()}});
+        qCDebug(lcData) << "Employee with ID" << employeeId << "updated.";
+        emit employeeUpdated(employeeId);
+        return true;
     }
-    qWarning() << "Failed to update. Employee with ID" << employeeId << "not found.";
+    qCWarning(lcData) << "Failed to update. Employee with ID" << employeeId << "not found.";
     return false;
 }
 
 bool DataManager::deleteEmployeeById(int employeeId)
 {
-    bool employeeRemoved = false;
-    // 1. 직원 목록에서 해당 ID의 직원 찾아 삭제
-    for (int i = 0; i < m_employees.size(); ++i) {
-        if (m_employees.at(i).getId() == employeeId) {
-            m_employees.removeAt(i);
-            employeeRemoved = true;
-            qDebug() << "Employee with ID" << employeeId << "removed from m_employees.";
-            break; // 찾았으면 루프 종료
-        }
-    }
-
-    if (!employeeRemoved) {
-        qWarning() << "Failed to delete. Employee with ID" << employeeId << "not found in m_employees.";
+    // 1. 직원 목록에서 해당 ID의 직원 찾아 삭제 (뒤쪽 직원들의 위치 색인은 한 칸씩 당김)
+    auto slotIt = m_employeeSlotById.find(employeeId);
+    if (slotIt == m_employeeSlotById.end()) {
+        qCWarning(lcData) << "Failed to delete. Employee with ID" << employeeId << "not found in m_employees.";
         return false;
     }
+    int slot = slotIt.value();
+    m_employeeSlotById.erase(slotIt);
+    m_employees.removeAt(slot);
+    rebuildEmployeeSlots(slot);
+    qCDebug(lcData) << "Employee with ID" << employeeId << "removed from m_employees.";
 
-    // 2. 근무 기록 목록(m_workLogs)에서 해당 employeeId를 가진 모든 WorkLog 삭제
-    // QMutableListIterator를 사용하면 반복 중 안전하게 항목을 삭제할 수 있습니다.
-    int logsRemovedCount = 0;
-    QMutableListIterator<WorkLog> iter(m_workLogs);
-    while (iter.hasNext()) {
-        // WorkLog 클래스에 getEmployeeId() 함수가 구현되어 있다고 가정합니다.
-        if (iter.next().getEmployeeId() == employeeId) {
-            iter.remove();
-            logsRemovedCount++;
-        }
+    // 2. 색인에서 해당 직원의 근무 기록 묶음을 통째로 제거
+    int logsRemovedCount = m_workLogsByEmployee.take(employeeId).size();
+    m_workTimeByEmployee.remove(employeeId);
+    if (logsRemovedCount > 0) {
+        invalidateWorkLogCache();
     }
-    qDebug() << logsRemovedCount << "worklog(s) for employee ID" << employeeId << "deleted.";
+    qCDebug(lcData) << logsRemovedCount << "worklog(s) for employee ID" << employeeId << "deleted.";
+    appendJournal(QJsonObject{{"op", "deleteEmployee"}, {"id", employeeId}});
+    emit employeeRemoved(employeeId);
     return true;
 }
 
 
 // --- WorkLog 관련 함수들 ---
-void DataManager::addWorkLog(const WorkLog &log)
+bool DataManager::addWorkLog(const WorkLog &log)
 {
     // WorkLog 객체는 이미 employeeId를 가지고 생성되었다고 가정합니다.
-    m_workLogs.append(log);
-    qDebug() << "Worklog added for employee ID:" << log.getEmployeeId() // getEmployeeIndex() 대신 getEmployeeId()
-             << "on date:" << log.getDate().toString("yyyy-MM-dd")
-             << "for hours:" << log.getHoursWorked();
+    if (!isWorkLogDateSupported(log.getDate())) {
+        qCWarning(lcData) << "Worklog rejected: date" << log.getDate() << "is outside the supported range";
+        return false;
+    }
+    if (hasSeconds(log)) {
+        qCWarning(lcData) << "Worklog seconds dropped: stored as whole minutes for employee ID:" << log.getEmployeeId()
+                          << "on date:" << log.getDate();
+    }
+    insertWorkLogIntoIndex(log);
+    appendJournal(QJsonObject{{"op", "addWorkLog"}, {"log", log.toJson()}});
+    LOG_HOT(lcData) << "Worklog added for employee ID:" << log.getEmployeeId()
+                    << "on date:" << log.getDate() << "minutes:" << log.getMinutesWorked();
+    emit workLogsChanged(log.getEmployeeId(), log.getDate(), log.getDate());
+    return true;
 }
 
-QList<WorkLog> DataManager::getWorkLogsForEmployeeOnDate(int employeeId, const QDate &date) const
+// 직원별 열 끝에 모두 덧붙인 뒤 바뀐 직원만 한 번씩 정렬 (건마다 삽입 위치를 찾아 밀어내지 않음)
+// 안정 정렬이므로 같은 날짜의 기존 기록 뒤에 입력 순서대로 붙어 addWorkLog를 반복한 것과 결과가 같음
+int DataManager::addWorkLogs(const QList<WorkLog> &logs)
 {
-    QList<WorkLog> resultLogs;
-    for (const WorkLog &log : m_workLogs) {
-        if (log.getEmployeeId() == employeeId && log.getDate() == date) { // getEmployeeIndex() 대신 getEmployeeId()
-            resultLogs.append(log);
+    TRACE_SCOPE("DataManager::addWorkLogs");
+    if (logs.isEmpty()) return 0;
+
+    struct DateRange {
+        QDate from;
+        QDate to;
+    };
+    QHash<int, DateRange> changedRanges;
+    QJsonArray logArray;
+    int addedCount = 0;
+    int secondsDroppedCount = 0;
+    for (const WorkLog &log : logs) {
+        if (!isWorkLogDateSupported(log.getDate())) continue; // addWorkLog와 같이 지원 기간 밖은 거부
+        ++addedCount;
+        if (hasSeconds(log)) ++secondsDroppedCount;
+        m_workLogsByEmployee[log.getEmployeeId()].append(log);
+        DateRange &range = changedRanges[log.getEmployeeId()];
+        if (!range.from.isValid() || log.getDate() < range.from) range.from = log.getDate();
+        if (!range.to.isValid() || log.getDate() > range.to) range.to = log.getDate();
+        if (m_journal.isOpen()) {
+            logArray.append(log.toJson());
         }
     }
+    for (auto it = changedRanges.constBegin(); it != changedRanges.constEnd(); ++it) {
+        WorkLogColumns &columns = m_workLogsByEmployee[it.key()];
+        columns.sortByDay();
+        m_workTimeByEmployee[it.key()].rebuild(columns);
+    }
+    if (addedCount < logs.size()) {
+        qCWarning(lcData) << logs.size() - addedCount << "worklog(s) rejected: date outside the supported range";
+    }
+    if (secondsDroppedCount > 0) {
+        qCWarning(lcData) << secondsDroppedCount << "worklog(s) had seconds dropped: stored as whole minutes";
+    }
+    if (addedCount == 0) return 0;
+    invalidateWorkLogCache();
+    appendJournal(QJsonObject{{"op", "addWorkLogs"}, {"logs", logArray}});
+    qCDebug(lcData) << addedCount << "worklog(s) added for" << changedRanges.size() << "employee(s)";
+
+    for (auto it = changedRanges.constBegin(); it != changedRanges.constEnd(); ++it) {
+        emit workLogsChanged(it.key(), it.value().from, it.value().to);
+    }
+    return addedCount;
+}
+
+QList<WorkLog> DataManager::getWorkLogsForEmployeeOnDate(int employeeId, const QDate &date) const
+{
+    QList<WorkLog> resultLogs;
+    auto indexIt = m_workLogsByEmployee.constFind(employeeId);
+    if (indexIt == m_workLogsByEmployee.constEnd()) return resultLogs;
+
+    const WorkLogColumns &columns = indexIt.value();
+    columns.appendTo(employeeId, columns.lowerBound(date), columns.upperBound(date), &resultLogs);
     return resultLogs;
 }
 
 QList<WorkLog> DataManager::getWorkLogsForDate(const QDate &date) const
 {
-    QList<WorkLog> resultLogs;
-    for (const WorkLog &log : m_workLogs) {
-        if (log.getDate() == date) {
-            resultLogs.append(log);
+    // 직원마다 날짜 열을 이진 탐색해서 해당 날짜 구간만 확인
+    // 해시 순서는 실행마다 달라질 수 있으므로 직원 목록 순서(getWorkLogsByDayForMonth와 같음)로 훑고,
+    // 직원 목록에 없는 ID의 기록(파일에서 불러온 고아 기록 등)은 그 뒤에 ID 오름차순으로 붙임
+    QList<int> employeeIds;
+    employeeIds.reserve(m_workLogsByEmployee.size());
+    for (const Employee &emp : m_employees) {
+        if (m_workLogsByEmployee.contains(emp.getId())) employeeIds.append(emp.getId());
+    }
+    if (employeeIds.size() < m_workLogsByEmployee.size()) {
+        const int knownCount = employeeIds.size();
+        for (auto indexIt = m_workLogsByEmployee.constBegin(); indexIt != m_workLogsByEmployee.constEnd(); ++indexIt) {
+            if (!m_employeeSlotById.contains(indexIt.key())) employeeIds.append(indexIt.key());
         }
+        std::sort(employeeIds.begin() + knownCount, employeeIds.end());
+    }
+
+    QList<WorkLog> resultLogs;
+    const qint32 day = WorkLogColumns::encodeDate(date);
+    for (int employeeId : std::as_const(employeeIds)) {
+        const WorkLogColumns &columns = *m_workLogsByEmployee.constFind(employeeId);
+        columns.appendTo(employeeId, columns.lowerBound(day), columns.upperBound(day), &resultLogs);
     }
     return resultLogs;
 }
 
-QList<WorkLog> DataManager::getWorkLogsForEmployeeForMonth(int employeeId, int year, int month) const
+QList<WorkLog> DataManager::getWorkLogsForEmployeeForMonth(int employeeId, int year, int month, qint64 *totalMinutes) const
+{
+    QDate firstDay(year, month, 1);
+    if (!firstDay.isValid()) {
+        if (totalMinutes) *totalMinutes = 0;
+        return {};
+    }
+    return getWorkLogsForEmployeeInRange(employeeId, firstDay, QDate(year, month, firstDay.daysInMonth()), totalMinutes);
+}
+
+QList<WorkLog> DataManager::getWorkLogsForEmployeeInRange(int employeeId, const QDate &startDate, const QDate &endDate,
+                                                          qint64 *totalMinutes) const
 {
     QList<WorkLog> resultLogs;
-    for (const WorkLog &log : m_workLogs) {
-        if (log.getEmployeeId() == employeeId && // getEmployeeIndex() 대신 getEmployeeId()
-            log.getDate().year() == year &&
-            log.getDate().month() == month) {
-            resultLogs.append(log);
+    if (totalMinutes) *totalMinutes = 0;
+    auto indexIt = m_workLogsByEmployee.constFind(employeeId);
+    if (indexIt == m_workLogsByEmployee.constEnd() || !startDate.isValid() || !endDate.isValid()) return resultLogs;
+
+    const WorkLogColumns &columns = indexIt.value();
+    const qint32 fromDay = WorkLogColumns::encodeDate(startDate);
+    const qint32 toDay = WorkLogColumns::encodeDate(endDate);
+    columns.appendTo(employeeId, columns.lowerBound(fromDay), columns.upperBound(toDay), &resultLogs);
+    if (totalMinutes) *totalMinutes = columns.sumMinutes(fromDay, toDay);
+    return resultLogs;
+}
+
+QVector<QList<WorkLog>> DataManager::getWorkLogsByDayForMonth(const QList<int> &employeeIds, int year, int month) const
+{
+    QDate firstDay(year, month, 1);
+    if (!firstDay.isValid()) return {};
+    const qint32 firstJulianDay = WorkLogColumns::encodeDate(firstDay);
+    const qint32 lastJulianDay = firstJulianDay + firstDay.daysInMonth() - 1;
+
+    QVector<QList<WorkLog>> logsByDay(firstDay.daysInMonth());
+    for (int employeeId : employeeIds) {
+        auto indexIt = m_workLogsByEmployee.constFind(employeeId);
+        if (indexIt == m_workLogsByEmployee.constEnd()) continue;
+
+        // 날짜 열이 정렬되어 있으므로 월 시작 행부터 월 끝 행까지만 훑음
+        const WorkLogColumns &columns = indexIt.value();
+        const int lastRow = columns.upperBound(lastJulianDay);
+        for (int row = columns.lowerBound(firstJulianDay); row < lastRow; ++row) {
+            logsByDay[columns.dayAt(row) - firstJulianDay].append(columns.at(employeeId, row));
         }
     }
-    return resultLogs;
+    return logsByDay;
 }
 
 // 특정 날짜의 특정 직원 근무 기록 모두 삭제
 bool DataManager::deleteWorkLogsForEmployeeOnDate(int employeeId, const QDate& date)
 {
-    bool changed = false;
-    QMutableListIterator<WorkLog> i(m_workLogs);
-    while (i.hasNext()) {
-        const WorkLog& log = i.next();
-        if (log.getEmployeeId() == employeeId && log.getDate() == date) { // getEmployeeIndex() 대신 getEmployeeId()
-            i.remove();
-            changed = true;
-        }
-    }
+    auto indexIt = m_workLogsByEmployee.find(employeeId);
+    if (indexIt == m_workLogsByEmployee.end()) return false;
+
+    WorkLogColumns &columns = indexIt.value();
+    const int firstRow = columns.lowerBound(date);
+    const int lastRow = columns.upperBound(date);
+    bool changed = (firstRow != lastRow);
     if (changed) {
-        qDebug() << "Worklogs for employee ID" << employeeId << "on date" << date.toString("yyyy-MM-dd") << "deleted.";
+        WorkTimeIndex &workTime = m_workTimeByEmployee[employeeId];
+        for (int row = firstRow; row < lastRow; ++row) {
+            workTime.apply(columns, row, -1);
+        }
+        columns.remove(firstRow, lastRow - firstRow);
+        if (columns.isEmpty()) {
+            m_workLogsByEmployee.erase(indexIt);
+        }
+        invalidateWorkLogCache();
+        appendJournal(QJsonObject{{"op", "deleteWorkLogsOnDate"}, {"employeeId", employeeId},
+                                  {"date", date.toString(Qt::ISODate)}});
+        LOG_HOT(lcData) << "Worklogs for employee ID" << employeeId << "on date" << date << "deleted.";
+        emit workLogsChanged(employeeId, date, date);
     }
     return changed;
 }
@@ -157,63 +350,338 @@ bool DataManager::deleteWorkLogsForEmployeeOnDate(int employeeId, const QDate& d
 // --- 데이터 저장/불러오기 함수 ---
 bool DataManager::saveData(const QString &filename) const
 {
-    QFile saveFile(filename);
+    TRACE_SCOPE("DataManager::saveData");
+    qint64 workLogCount = 0;
+    const BinarySnapshot::WorkLogSource source = workLogSource(m_workLogsByEmployee, &workLogCount);
+    if (!writeSnapshot(filename, m_nextEmployeeId, m_journal.lastSequence(), m_employees, workLogCount, source)) {
+        return false;
+    }
+    qCInfo(lcData) << "Data saved to" << filename << ". NextEmployeeId:" << m_nextEmployeeId
+                   << "Employees:" << m_employees.size() << "Worklogs:" << workLogCount;
+    return true;
+}
+
+BinarySnapshot::WorkLogSource DataManager::workLogSource(const QHash<int, WorkLogColumns> &columnsByEmployee,
+                                                         qint64 *workLogCount)
+{
+    QList<int> employeeIds = columnsByEmployee.keys();
+    std::sort(employeeIds.begin(), employeeIds.end());
+    qint64 count = 0;
+    for (const WorkLogColumns &columns : columnsByEmployee) {
+        count += columns.size();
+    }
+    *workLogCount = count;
+
+    return [columnsByEmployee, employeeIds](const BinarySnapshot::WorkLogVisitor &visit) {
+        for (int employeeId : employeeIds) {
+            const WorkLogColumns &columns = *columnsByEmployee.constFind(employeeId);
+            for (int row = 0; row < columns.size(); ++row) {
+                visit(columns.at(employeeId, row));
+            }
+        }
+    };
+}
+
+// 확장자가 .json이면 교환용 JSON, 그 외에는 바이너리 스냅샷으로 저장
+// 작업 스레드에서도 호출되므로 멤버 변수에 접근하지 않고 인자로 받은 데이터만 사용
+bool DataManager::writeSnapshot(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                                const QList<Employee> &employees, qint64 workLogCount,
+                                const BinarySnapshot::WorkLogSource &source)
+{
+    TRACE_SCOPE("DataManager::writeSnapshot");
+    if (QFileInfo(filename).suffix().compare("json", Qt::CaseInsensitive) == 0) {
+        return writeJsonSnapshot(filename, nextEmployeeId, journalSequence, employees, source);
+    }
+    return BinarySnapshot::write(filename, nextEmployeeId, journalSequence, employees, workLogCount, source);
+}
+
+bool DataManager::writeJsonSnapshot(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                                    const QList<Employee> &employees, const BinarySnapshot::WorkLogSource &source)
+{
+    QSaveFile saveFile(filename); // 다 쓴 뒤 한 번에 교체되므로 저장 도중 죽어도 기존 파일이 깨지지 않음
     if (!saveFile.open(QIODevice::WriteOnly)) {
-        qWarning("Couldn't open save file for writing.");
+        qCCritical(lcData) << "Couldn't open save file for writing:" << filename;
         return false;
     }
 
     QJsonObject rootObject;
-    rootObject["nextEmployeeId"] = m_nextEmployeeId; // m_nextEmployeeId 저장
+    rootObject["nextEmployeeId"] = nextEmployeeId; // m_nextEmployeeId 저장
+    rootObject["journalSequence"] = journalSequence; // 이 스냅샷에 반영된 마지막 저널 순번
 
     QJsonArray employeeArray;
-    for (const Employee &emp : m_employees) {
+    for (const Employee &emp : employees) {
         employeeArray.append(emp.toJson()); // Employee::toJson()이 ID를 포함해야 함
     }
     rootObject["employees"] = employeeArray;
 
     QJsonArray worklogArray;
-    for (const WorkLog &log : m_workLogs) {
+    source([&worklogArray](const WorkLog &log) {
         worklogArray.append(log.toJson()); // WorkLog::toJson()이 employeeId를 포함해야 함
-    }
+    });
     rootObject["worklogs"] = worklogArray;
 
     QJsonDocument saveDoc(rootObject);
     saveFile.write(saveDoc.toJson()); // 텍스트 기반 JSON으로 저장
-    qDebug() << "Data saved to" << filename << ". NextEmployeeId:" << m_nextEmployeeId
-             << "Employees:" << m_employees.size() << "Worklogs:" << m_workLogs.size();
+    if (!saveFile.commit()) {
+        qCCritical(lcData) << "Failed to write" << filename << ":" << saveFile.errorString();
+        return false;
+    }
     return true;
 }
 
 bool DataManager::loadData(const QString &filename)
 {
+    TRACE_SCOPE("DataManager::loadData");
+    // 바이너리 스냅샷은 파일 앞의 매직 값으로 구분하고, 나머지는 JSON으로 읽음
+    bool loaded = BinarySnapshot::isBinarySnapshot(filename) ? loadBinarySnapshot(filename)
+                                                             : loadJsonSnapshot(filename);
+    if (loaded) {
+        emit dataReset();
+    }
+    return loaded;
+}
+
+namespace {
+// 근무 기록 객체 하나를 읽음 (BeginObject 토큰을 읽은 직후에 호출)
+// WorkLog::fromJson과 같은 규칙: 없는 필드나 타입이 다른 필드는 -1 / 무효 날짜·시간
+bool readWorkLogObject(JsonStreamReader &reader, WorkLog *log)
+{
+    enum Field { OtherField, EmployeeIdField, DateField, StartTimeField, EndTimeField };
+
+    int employeeId = -1;
+    QDate date;
+    QTime startTime, endTime;
+
+    while (reader.readNext() == JsonStreamReader::Name) {
+        const QByteArray &key = reader.rawValue();
+        Field field = OtherField;
+        if (key == "employeeId") field = EmployeeIdField;
+        else if (key == "date") field = DateField;
+        else if (key == "startTime") field = StartTimeField;
+        else if (key == "endTime") field = EndTimeField;
+
+        JsonStreamReader::TokenType token = reader.readNext();
+        const bool isString = (token == JsonStreamReader::String);
+        switch (field) {
+        case EmployeeIdField:
+            employeeId = (token == JsonStreamReader::Number) ? reader.numberValue().toInt(-1) : -1;
+            break;
+        case DateField:
+            date = isString ? WorkLog::parseIsoDate(reader.rawValue()) : QDate();
+            break;
+        case StartTimeField:
+            startTime = isString ? WorkLog::parseTime(reader.rawValue()) : QTime();
+            break;
+        case EndTimeField:
+            endTime = isString ? WorkLog::parseTime(reader.rawValue()) : QTime();
+            break;
+        case OtherField:
+            break;
+        }
+        if (!reader.skipCurrentValue()) return false;
+    }
+    if (reader.tokenType() != JsonStreamReader::EndObject) return false;
+
+    *log = WorkLog(employeeId, date, startTime, endTime);
+    return true;
+}
+
+// "employees" 배열을 읽음 (BeginArray 토큰을 읽은 직후에 호출). 직원 객체는 작으므로 QJsonObject로 변환
+bool readEmployeeArray(JsonStreamReader &reader, QList<Employee> *employees)
+{
+    while (reader.readNext() != JsonStreamReader::EndArray) {
+        QJsonValue element;
+        if (!reader.readCurrentValue(&element)) return false;
+        employees->append(Employee::fromJson(element.toObject())); // 객체가 아니면 빈 객체로 처리 (기존 로더와 동일)
+    }
+    return true;
+}
+
+// 배열의 근무 기록 원소들을 순서대로 읽어 sink에 넘김 (BeginArray 토큰을 읽은 직후에 호출)
+template <typename Sink>
+bool readWorkLogElements(JsonStreamReader &reader, Sink sink)
+{
+    for (;;) {
+        JsonStreamReader::TokenType token = reader.readNext();
+        if (token == JsonStreamReader::EndArray) return true;
+
+        WorkLog log; // 객체가 아닌 원소는 빈 객체와 같은 기본 WorkLog
+        if (token == JsonStreamReader::BeginObject) {
+            if (!readWorkLogObject(reader, &log)) return false;
+        } else if (!reader.skipCurrentValue()) {
+            return false;
+        }
+        sink(log);
+    }
+}
+
+// "worklogs" 배열을 읽어 직원별로 모음 (BeginArray 토큰을 읽은 직후에 호출)
+bool readWorkLogArray(JsonStreamReader &reader, QHash<int, WorkLogColumns> *workLogsByEmployee, int *count,
+                      DataManager::LoadStatistics *stats)
+{
+    return readWorkLogElements(reader, [&](const WorkLog &log) {
+        if (hasSeconds(log)) ++stats->secondsDroppedCount;
+        (*workLogsByEmployee)[log.getEmployeeId()].append(log);
+        ++*count;
+    });
+}
+
+// 병렬 파싱 단위: 배열 안의 [begin, end) 바이트 범위와 그 범위에서 읽은 근무 기록
+struct WorkLogChunk {
+    qint64 begin = 0;
+    qint64 end = 0;
+    QList<WorkLog> logs;
+    bool ok = false;
+};
+
+// 병렬 경로를 쓰기 시작하는 파일 크기와 청크당 근무 기록 수
+const qint64 kParallelLoadMinBytes = 8 * 1024 * 1024;
+const int kWorkLogsPerChunk = 16384;
+
+// 메모리 매핑된 파일에서 "worklogs" 배열을 원소 경계로 나누어 스레드 풀에서 파싱한 뒤 파일 순서대로 합침
+// (BeginArray 토큰을 읽은 직후에 호출, reader는 매핑된 전체 파일을 읽는 메모리 범위 모드)
+bool readWorkLogArrayParallel(JsonStreamReader &reader, const char *fileData,
+                              QHash<int, WorkLogColumns> *workLogsByEmployee, int *count,
+                              DataManager::LoadStatistics *stats)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    // 1단계(순차): 구조만 훑어서 원소 경계 찾기
+    const qint64 arrayBegin = reader.offset();
+    QList<qint64> splitOffsets;
+    if (!reader.skipArrayRecordingSplits(kWorkLogsPerChunk, &splitOffsets)) return false;
+    const qint64 arrayEnd = reader.offset() - 1; // 닫는 ']' 위치
+
+    QList<WorkLogChunk> chunks;
+    qint64 chunkBegin = arrayBegin;
+    for (qint64 split : splitOffsets) {
+        WorkLogChunk chunk;
+        chunk.begin = chunkBegin;
+        chunk.end = split; // 구분 ','는 포함하지 않음
+        chunks.append(chunk);
+        chunkBegin = split + 1;
+    }
+    WorkLogChunk lastChunk;
+    lastChunk.begin = chunkBegin;
+    lastChunk.end = arrayEnd;
+    chunks.append(lastChunk);
+    stats->scanMs = timer.restart();
+
+    // 2단계(병렬): 청크마다 독립적인 리더로 파싱
+    QtConcurrent::blockingMap(chunks, [fileData](WorkLogChunk &chunk) {
+        JsonStreamReader chunkReader(fileData + chunk.begin, chunk.end - chunk.begin);
+        chunkReader.beginArrayFragment();
+        chunk.ok = readWorkLogElements(chunkReader, [&chunk](const WorkLog &log) { chunk.logs.append(log); });
+    });
+    stats->parseMs = timer.restart();
+    stats->chunkCount = chunks.size();
+
+    // 3단계(순차): 파일 순서대로 직원별 목록에 합침
+    for (WorkLogChunk &chunk : chunks) {
+        if (!chunk.ok) return false;
+        for (const WorkLog &log : std::as_const(chunk.logs)) {
+            if (hasSeconds(log)) ++stats->secondsDroppedCount;
+            (*workLogsByEmployee)[log.getEmployeeId()].append(log);
+        }
+        *count += chunk.logs.size();
+        chunk.logs.clear(); // 합친 청크는 바로 해제해서 최대 메모리 사용량을 줄임
+    }
+    stats->mergeMs = timer.restart();
+    return true;
+}
+}
+
+// JSON 스냅샷을 스트리밍으로 불러오기
+// 파일을 고정 크기 청크로 읽으며 바로 직원/근무 기록으로 변환하므로 파일 전체나 DOM을 메모리에 올리지 않음
+// 중간에 형식 오류가 나면 기존 데이터는 그대로 두고 false 반환
+// 큰 파일은 메모리 매핑한 뒤 "worklogs" 배열만 여러 스레드에서 나눠 파싱 (결과는 파일 순서와 동일)
+bool DataManager::loadJsonSnapshot(const QString &filename)
+{
+    QElapsedTimer totalTimer;
+    totalTimer.start();
+
     QFile loadFile(filename);
     if (!loadFile.open(QIODevice::ReadOnly)) {
-        qWarning("Couldn't open save file for reading. No existing data or file not found.");
+        qCWarning(lcData, "Couldn't open save file for reading. No existing data or file not found.");
         return false;
     }
 
-    QByteArray saveData = loadFile.readAll();
-    QJsonDocument loadDoc(QJsonDocument::fromJson(saveData));
+    LoadStatistics stats;
+    stats.fileBytes = loadFile.size();
+    stats.threadCount = 1;
+
+    const char *mappedData = nullptr;
+    const int idealThreads = QThread::idealThreadCount();
+    if (stats.fileBytes >= kParallelLoadMinBytes && idealThreads > 1) {
+        mappedData = reinterpret_cast<const char *>(loadFile.map(0, stats.fileBytes));
+        if (mappedData) {
+            stats.threadCount = idealThreads;
+        }
+    }
 
-    if (loadDoc.isNull() || !loadDoc.isObject()) {
-        qWarning("Failed to create QJsonDocument from file or it's not an object.");
+    JsonStreamReader reader = mappedData ? JsonStreamReader(mappedData, stats.fileBytes)
+                                         : JsonStreamReader(&loadFile);
+    if (reader.readNext() != JsonStreamReader::BeginObject) {
+        qCWarning(lcData, "Failed to parse JSON data from file or it's not an object.");
         return false;
     }
 
-    QJsonObject rootObject = loadDoc.object();
+    int nextEmployeeId = 1; // 파일에 없으면 기본값 1
+    qint64 journalSequence = 0; // 저널 없이 저장된 예전 파일에는 순번이 없으므로 0
+    bool hasEmployees = false;
+    QList<Employee> employees;
+    QHash<int, WorkLogColumns> workLogsByEmployee;
+    int workLogCount = 0;
+    bool ok = true;
 
-    // m_nextEmployeeId 불러오기 (Employee 목록보다 먼저 또는 직원 ID 최대값 계산 후 설정)
-    m_nextEmployeeId = rootObject.value("nextEmployeeId").toInt(1); // 파일에 없으면 기본값 1
+    while (ok && reader.readNext() == JsonStreamReader::Name) {
+        const QByteArray key = reader.rawValue();
+        if (key == "nextEmployeeId" || key == "journalSequence") {
+            QJsonValue value;
+            ok = reader.readNextValue(&value);
+            if (key == "nextEmployeeId") {
+                nextEmployeeId = value.toInt(1);
+            } else {
+                journalSequence = static_cast<qint64>(value.toDouble(0));
+            }
+        } else if (key == "employees" || key == "worklogs") {
+            if (reader.readNext() != JsonStreamReader::BeginArray) {
+                ok = reader.skipCurrentValue(); // 배열이 아니면 무시 (기존 로더와 동일)
+            } else if (key == "employees") {
+                hasEmployees = true;
+                employees.clear();
+                ok = readEmployeeArray(reader, &employees);
+            } else {
+                workLogsByEmployee.clear();
+                workLogCount = 0;
+                stats.secondsDroppedCount = 0;
+                ok = mappedData ? readWorkLogArrayParallel(reader, mappedData, &workLogsByEmployee, &workLogCount, &stats)
+                                : readWorkLogArray(reader, &workLogsByEmployee, &workLogCount, &stats);
+            }
+        } else {
+            ok = reader.skipNextValue();
+        }
+    }
 
-    m_employees.clear();
-    if (rootObject.contains("employees") && rootObject["employees"].isArray()) {
-        QJsonArray employeeArray = rootObject["employees"].toArray();
+    if (!ok || reader.tokenType() != JsonStreamReader::EndObject
+        || reader.readNext() != JsonStreamReader::EndOfDocument) {
+        qCWarning(lcData) << "Failed to parse JSON data from" << filename << ":" << reader.errorString();
+        return false;
+    }
+    if (!mappedData) {
+        stats.parseMs = totalTimer.elapsed(); // 스트리밍 경로는 읽기와 파싱이 한 단계
+    }
+
+    // 모두 성공적으로 읽은 뒤에만 멤버에 반영
+    m_nextEmployeeId = nextEmployeeId;
+    m_snapshotSequence = journalSequence;
+
+    m_employees = employees;
+    rebuildEmployeeSlots();
+    if (hasEmployees) {
         int maxIdLoaded = 0;
-        for (int i = 0; i < employeeArray.size(); ++i) {
-            QJsonObject empObject = employeeArray[i].toObject();
-            Employee emp = Employee::fromJson(empObject); // Employee::fromJson()이 ID를 처리해야 함
-            m_employees.append(emp);
+        for (const Employee &emp : m_employees) {
             if (emp.getId() > maxIdLoaded) {
                 maxIdLoaded = emp.getId();
             }
@@ -224,25 +692,176 @@ bool DataManager::loadData(const QString &filename)
         }
     }
 
+    QElapsedTimer indexTimer;
+    indexTimer.start();
+    m_workLogsByEmployee = std::move(workLogsByEmployee);
+    invalidateWorkLogCache();
+    sortWorkLogIndex(stats.threadCount > 1);
+    workLogCount -= removeUnsupportedWorkLogs();
+    rebuildWorkTimeIndex();
+    stats.indexMs = indexTimer.elapsed();
+
+    stats.workLogCount = workLogCount;
+    stats.totalMs = totalTimer.elapsed();
+    m_lastLoadStatistics = stats;
+    if (stats.secondsDroppedCount > 0) {
+        // 다음 저장부터는 분 단위 시각(HH:mm:00)으로 기록됨
+        qCWarning(lcData) << stats.secondsDroppedCount << "worklog(s) in" << filename
+                          << "have non-zero seconds; they are kept as whole minutes";
+    }
+    qCInfo(lcData) << "Data loaded from" << filename << ". NextEmployeeId:" << m_nextEmployeeId
+                   << "Employees count:" << m_employees.size() << "Worklogs count:" << workLogCount;
+    qCDebug(lcData) << "Load timings (ms): threads" << stats.threadCount << "chunks" << stats.chunkCount
+                    << "scan" << stats.scanMs << "parse" << stats.parseMs << "merge" << stats.mergeMs
+                    << "index" << stats.indexMs << "total" << stats.totalMs;
+    return true;
+}
+
+// 바이너리 스냅샷 불러오기 (메모리 매핑된 열에서 바로 값을 가져옴)
+bool DataManager::loadBinarySnapshot(const QString &filename)
+{
+    BinarySnapshot::Contents contents;
+    if (!BinarySnapshot::read(filename, &contents)) {
+        return false;
+    }
+
+    m_nextEmployeeId = contents.nextEmployeeId;
+    m_snapshotSequence = contents.journalSequence;
 
-    m_workLogs.clear();
-    if (rootObject.contains("worklogs") && rootObject["worklogs"].isArray()) {
-        QJsonArray worklogArray = rootObject["worklogs"].toArray();
-        for (int i = 0; i < worklogArray.size(); ++i) {
-            QJsonObject logObject = worklogArray[i].toObject();
-            m_workLogs.append(WorkLog::fromJson(logObject)); // WorkLog::fromJson()이 employeeId를 처리해야 함
+    m_employees = contents.employees;
+    rebuildEmployeeSlots();
+    for (const Employee &emp : m_employees) {
+        if (m_nextEmployeeId <= emp.getId()) {
+            m_nextEmployeeId = emp.getId() + 1;
         }
     }
-    qDebug() << "Data loaded from" << filename << ". NextEmployeeId:" << m_nextEmployeeId
-             << "Employees count:" << m_employees.size() << "Worklogs count:" << m_workLogs.size();
+
+    // 파일의 열을 같은 직원 ID가 이어지는 구간 단위로 직원별 열에 통째로 복사
+    // DataManager가 쓴 파일은 직원마다 한 구간이고 날짜순이므로 정렬은 순서가 어긋난 직원만 함
+    m_workLogsByEmployee.clear();
+    invalidateWorkLogCache();
+    const int count = contents.days.size();
+    const qint32 *employeeIds = contents.employeeIds.constData();
+    const qint32 *days = contents.days.constData();
+    QSet<int> unsortedEmployees;
+    int runBegin = 0;
+    while (runBegin < count) {
+        const qint32 employeeId = employeeIds[runBegin];
+        bool sorted = true;
+        int runEnd = runBegin + 1;
+        for (; runEnd < count && employeeIds[runEnd] == employeeId; ++runEnd) {
+            if (days[runEnd] < days[runEnd - 1]) sorted = false;
+        }
+        WorkLogColumns &columns = m_workLogsByEmployee[employeeId];
+        if (!columns.isEmpty() && days[runBegin] < columns.dayAt(columns.size() - 1)) sorted = false;
+        columns.appendRows(days + runBegin, contents.startMinutes.constData() + runBegin,
+                           contents.endMinutes.constData() + runBegin, runEnd - runBegin);
+        if (!sorted) unsortedEmployees.insert(employeeId);
+        runBegin = runEnd;
+    }
+    for (int employeeId : std::as_const(unsortedEmployees)) {
+        m_workLogsByEmployee[employeeId].sortByDay();
+    }
+    rebuildWorkTimeIndex(); // 날짜는 BinarySnapshot::read가 지원 기간 안인지 이미 확인함
+
+    qCInfo(lcData) << "Binary snapshot loaded from" << filename << ". NextEmployeeId:" << m_nextEmployeeId
+                   << "Employees count:" << m_employees.size() << "Worklogs count:" << count;
     return true;
 }
 
+// 직원별로 모은 근무 기록을 한 번에 날짜순 정렬 (stable_sort라 같은 날짜는 파일 순서 유지)
+// parallel이면 직원 단위로 스레드 풀에 나눠서 정렬
+void DataManager::sortWorkLogIndex(bool parallel)
+{
+    QList<WorkLogColumns *> lists;
+    lists.reserve(m_workLogsByEmployee.size());
+    for (auto it = m_workLogsByEmployee.begin(); it != m_workLogsByEmployee.end(); ++it) {
+        lists.append(&it.value());
+    }
+
+    auto sortByDate = [](WorkLogColumns *columns) { columns->sortByDay(); };
+    if (parallel) {
+        QtConcurrent::blockingMap(lists, sortByDate);
+    } else {
+        std::for_each(lists.begin(), lists.end(), sortByDate);
+    }
+}
+
+// 불러온 근무 기록 중 지원 기간 밖의 날짜를 버리고 버린 건수를 반환 (열은 날짜순으로 정렬된 상태여야 함)
+// 앞쪽의 날짜 없는 행(kInvalidDay)은 남기고, 그 뒤 지원 기간 이전 구간과 이후 구간만 잘라 냄
+int DataManager::removeUnsupportedWorkLogs()
+{
+    const qint32 firstDay = qint32(WorkTimeIndex::kFirstSupportedDay);
+    const qint32 lastDay = qint32(WorkTimeIndex::kLastSupportedDay);
+    int removedCount = 0;
+    for (auto it = m_workLogsByEmployee.begin(); it != m_workLogsByEmployee.end();) {
+        WorkLogColumns &columns = it.value();
+        const int afterEnd = columns.upperBound(lastDay);
+        const int trailing = columns.size() - afterEnd;
+        if (trailing > 0) columns.remove(afterEnd, trailing);
+        const int beforeBegin = columns.upperBound(WorkLogColumns::kInvalidDay);
+        const int leading = columns.lowerBound(firstDay) - beforeBegin;
+        if (leading > 0) columns.remove(beforeBegin, leading);
+        removedCount += trailing + leading;
+        if (columns.isEmpty()) {
+            it = m_workLogsByEmployee.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (removedCount > 0) {
+        invalidateWorkLogCache();
+        qCWarning(lcData) << removedCount << "worklog(s) dropped on load: date outside the supported range";
+    }
+    return removedCount;
+}
+
+void DataManager::rebuildWorkTimeIndex()
+{
+    m_workTimeByEmployee.clear();
+    for (auto it = m_workLogsByEmployee.constBegin(); it != m_workLogsByEmployee.constEnd(); ++it) {
+        m_workTimeByEmployee[it.key()].rebuild(it.value());
+    }
+}
+
+qint64 DataManager::getTotalMinutesForEmployee(int employeeId, const QDate &startDate, const QDate &endDate) const
+{
+    auto it = m_workTimeByEmployee.constFind(employeeId);
+    if (it == m_workTimeByEmployee.constEnd() || !startDate.isValid() || !endDate.isValid()) return 0;
+    return it.value().sumMinutes(startDate.toJulianDay(), endDate.toJulianDay());
+}
+
+QMap<QDate, qint64> DataManager::getWeeklyMinutesForEmployee(int employeeId, const QDate &startDate, const QDate &endDate) const
+{
+    QMap<QDate, qint64> weeklyMinutes;
+    auto it = m_workTimeByEmployee.constFind(employeeId);
+    if (it == m_workTimeByEmployee.constEnd() || !startDate.isValid() || !endDate.isValid()) return weeklyMinutes;
+
+    const auto weeks = it.value().weeklyMinutes(startDate.toJulianDay(), endDate.toJulianDay());
+    for (const auto &week : weeks) {
+        weeklyMinutes.insert(QDate::fromJulianDay(week.first), week.second);
+    }
+    return weeklyMinutes;
+}
+
+DataSnapshot DataManager::snapshot() const
+{
+    return DataSnapshot(m_employees, m_employeeSlotById, m_workTimeByEmployee);
+}
+
+const DataManager::LoadStatistics &DataManager::lastLoadStatistics() const
+{
+    return m_lastLoadStatistics;
+}
+
 WorkLog DataManager::getWorkLogByEmployeeAndDate(int employeeId, const QDate& date) const
 {
-    for (const WorkLog& log : m_workLogs) {
-        if (log.getEmployeeId() == employeeId && log.getDate() == date) {
-            return log;
+    auto indexIt = m_workLogsByEmployee.constFind(employeeId);
+    if (indexIt != m_workLogsByEmployee.constEnd()) {
+        const WorkLogColumns &columns = indexIt.value();
+        const int row = columns.lowerBound(date);
+        if (row < columns.size() && columns.dayAt(row) == WorkLogColumns::encodeDate(date)) {
+            return columns.at(employeeId, row);
         }
     }
     return WorkLog(-1, QDate(), QTime(), QTime()); // 찾지 못한 경우
@@ -250,28 +869,231 @@ WorkLog DataManager::getWorkLogByEmployeeAndDate(int employeeId, const QDate& da
 
 bool DataManager::updateWorkLog(const WorkLog& oldLog, const WorkLog& newLog)
 {
-    for (int i = 0; i < m_workLogs.size(); ++i) {
-        if (m_workLogs[i].getEmployeeId() == oldLog.getEmployeeId() &&
-            m_workLogs[i].getDate() == oldLog.getDate()) {
-            m_workLogs[i] = newLog;
-            return true;
+    if (!isWorkLogDateSupported(newLog.getDate())) {
+        qCWarning(lcData) << "Worklog update rejected: date" << newLog.getDate() << "is outside the supported range";
+        return false;
+    }
+    if (hasSeconds(newLog)) {
+        qCWarning(lcData) << "Worklog seconds dropped: stored as whole minutes for employee ID:" << newLog.getEmployeeId()
+                          << "on date:" << newLog.getDate();
+    }
+    auto indexIt = m_workLogsByEmployee.find(oldLog.getEmployeeId());
+    if (indexIt == m_workLogsByEmployee.end()) return false;
+
+    WorkLogColumns &columns = indexIt.value();
+    const int row = columns.lowerBound(oldLog.getDate());
+    if (row == columns.size() || columns.dayAt(row) != WorkLogColumns::encodeDate(oldLog.getDate())) return false;
+
+    WorkTimeIndex &oldWorkTime = m_workTimeByEmployee[oldLog.getEmployeeId()];
+    oldWorkTime.apply(columns, row, -1);
+    if (newLog.getEmployeeId() == oldLog.getEmployeeId() && newLog.getDate() == oldLog.getDate()) {
+        columns.replace(row, newLog); // 정렬 위치가 그대로이므로 제자리에서 교체
+        oldWorkTime.apply(columns, row, 1);
+        invalidateWorkLogCache();
+    } else {
+        // 직원이나 날짜가 바뀌면 기존 위치에서 빼고 새 위치에 삽입
+        columns.remove(row);
+        if (columns.isEmpty()) {
+            m_workLogsByEmployee.erase(indexIt);
         }
+        insertWorkLogIntoIndex(newLog);
     }
-    return false;
+    appendJournal(QJsonObject{{"op", "updateWorkLog"}, {"old", oldLog.toJson()}, {"log", newLog.toJson()}});
+    emit workLogsChanged(oldLog.getEmployeeId(), oldLog.getDate(), oldLog.getDate());
+    if (newLog.getEmployeeId() != oldLog.getEmployeeId() || newLog.getDate() != oldLog.getDate()) {
+        emit workLogsChanged(newLog.getEmployeeId(), newLog.getDate(), newLog.getDate());
+    }
+    return true;
 }
+
+// 전체 근무 기록 목록 반환 (직원 ID 순, 직원 안에서는 날짜순, 같은 날짜는 입력 순서)
+// 색인에서 다시 만들기 때문에 직원을 넘나드는 입력 순서는 남지 않음 (헤더 참고)
 const QList<WorkLog>& DataManager::getWorkLogs() const
 {
+    if (!m_workLogCacheValid) {
+        QList<int> employeeIds = m_workLogsByEmployee.keys();
+        std::sort(employeeIds.begin(), employeeIds.end());
+
+        m_workLogs.clear();
+        for (int employeeId : employeeIds) {
+            const WorkLogColumns &columns = *m_workLogsByEmployee.constFind(employeeId);
+            columns.appendTo(employeeId, 0, columns.size(), &m_workLogs);
+        }
+        m_workLogCacheValid = true;
+    }
     return m_workLogs;
 }
 
 bool DataManager::deleteWorkLog(int employeeId, const QDate& date)
 {
-    for (int i = 0; i < m_workLogs.size(); ++i) {
-        if (m_workLogs[i].getEmployeeId() == employeeId &&
-            m_workLogs[i].getDate() == date) {
-            m_workLogs.removeAt(i);
-            return true;
+    auto indexIt = m_workLogsByEmployee.find(employeeId);
+    if (indexIt == m_workLogsByEmployee.end()) return false;
+
+    WorkLogColumns &columns = indexIt.value();
+    const int row = columns.lowerBound(date);
+    if (row == columns.size() || columns.dayAt(row) != WorkLogColumns::encodeDate(date)) return false;
+
+    m_workTimeByEmployee[employeeId].apply(columns, row, -1);
+    columns.remove(row);
+    if (columns.isEmpty()) {
+        m_workLogsByEmployee.erase(indexIt);
+    }
+    invalidateWorkLogCache();
+    appendJournal(QJsonObject{{"op", "deleteWorkLog"}, {"employeeId", employeeId},
+                              {"date", date.toString(Qt::ISODate)}});
+    emit workLogsChanged(employeeId, date, date);
+    return true;
+}
+
+// --- 저널 기반 저장소 ---
+bool DataManager::openStore(const QString &snapshotPath, StoreMode mode)
+{
+    TRACE_SCOPE("DataManager::openStore");
+    closeStore();
+    m_snapshotPath = snapshotPath;
+    m_snapshotSequence = 0;
+
+    // 불러오기와 저널 재생 중의 개별 변경 시그널은 막고, 끝난 뒤 dataReset 한 번만 보냄
+    QSignalBlocker signalBlocker(this);
+    bool snapshotLoaded = loadData(snapshotPath);
+
+    // 압축 도중 남은 .journal.old → 활성 .journal 순으로, 스냅샷 이후의 레코드만 재생
+    // (저널이 아직 열려 있지 않으므로 재생 중인 변경은 다시 기록되지 않음)
+    qint64 lastSequence = m_snapshotSequence;
+    int replayedCount = 0;
+    const QStringList journalPaths = {DataJournal::rotatedJournalPathFor(snapshotPath),
+                                      DataJournal::journalPathFor(snapshotPath)};
+    for (const QString &journalPath : journalPaths) {
+        const QList<QJsonObject> records = DataJournal::readRecords(journalPath);
+        for (const QJsonObject &record : records) {
+            qint64 sequence = static_cast<qint64>(record.value("seq").toDouble(0));
+            if (sequence <= lastSequence) continue; // 이미 스냅샷에 반영된 레코드
+            if (!applyJournalRecord(record)) {
+                qCWarning(lcJournal) << "Journal record" << sequence << "could not be applied:" << record.value("op").toString();
+            }
+            lastSequence = sequence;
+            ++replayedCount;
+        }
+    }
+    m_journal.setLastSequence(lastSequence);
+
+    if (replayedCount > 0) {
+        qCInfo(lcJournal) << "Replayed" << replayedCount << "journal record(s) over" << snapshotPath;
+    }
+    if (mode == ReadWrite) {
+        if (m_journal.open(snapshotPath)) {
+            // 재생한 레코드도 아직 스냅샷에 없으므로 압축 기준에 넣음 (짧은 실행이 반복돼도 저널이 끝없이 자라지 않도록)
+            m_journal.setPendingRecordCount(replayedCount);
+            if (replayedCount >= kJournalCompactionThreshold) {
+                startBackgroundCompaction();
+            }
+        } else {
+            qCWarning(lcJournal) << "Changes will not be journaled for" << snapshotPath;
+        }
+    }
+
+    signalBlocker.unblock();
+    emit dataReset();
+    return snapshotLoaded || replayedCount > 0;
+}
+
+void DataManager::closeStore()
+{
+    m_compaction.waitForFinished();
+    if (m_journal.isOpen() && m_journal.pendingRecordCount() >= kJournalCompactionThreshold) {
+        compactStore(); // 직전 압축이 실행 중이라 건너뛴 레코드가 기준을 넘긴 경우
+    }
+    m_journal.close();
+}
+
+bool DataManager::compactStore()
+{
+    if (m_snapshotPath.isEmpty() || !m_journal.isOpen()) return false;
+
+    m_compaction.waitForFinished();
+    if (!startBackgroundCompaction()) return false;
+    m_compaction.waitForFinished();
+    return m_compaction.result();
+}
+
+void DataManager::appendJournal(const QJsonObject &record)
+{
+    if (!m_journal.isOpen()) return;
+
+    m_journal.append(record);
+    if (m_journal.pendingRecordCount() >= kJournalCompactionThreshold) {
+        startBackgroundCompaction();
+    }
+}
+
+bool DataManager::startBackgroundCompaction()
+{
+    if (m_compaction.isRunning()) return false; // 이전 압축이 끝나면 다음 기록 때 다시 시도
+    if (!m_journal.rotate()) return false;
+
+    // 암시적 공유(COW) 덕분에 목록 복사는 가볍고, 이후 GUI 스레드의 수정과도 분리됨
+    const QString snapshotPath = m_snapshotPath;
+    const QString rotatedPath = m_journal.rotatedJournalPath();
+    const int nextEmployeeId = m_nextEmployeeId;
+    const qint64 journalSequence = m_journal.lastSequence();
+    const QList<Employee> employees = m_employees;
+    qint64 workLogCount = 0;
+    const BinarySnapshot::WorkLogSource source = workLogSource(m_workLogsByEmployee, &workLogCount);
+
+    m_compaction = QtConcurrent::run([=]() {
+        if (!writeSnapshot(snapshotPath, nextEmployeeId, journalSequence, employees, workLogCount, source)) {
+            return false; // .journal.old가 남아 있으므로 다음 시작 때 재생됨
+        }
+        QFile::remove(rotatedPath);
+        return true;
+    });
+    return true;
+}
+
+bool DataManager::applyJournalRecord(const QJsonObject &record)
+{
+    const QString op = record.value("op").toString();
+
+    if (op == "addEmployee") {
+        Employee emp = Employee::fromJson(record.value("employee").toObject());
+        if (emp.getId() < 0 || m_employeeSlotById.contains(emp.getId())) return false;
+        m_employees.append(emp);
+        m_employeeSlotById.insert(emp.getId(), m_employees.size() - 1);
+        if (m_nextEmployeeId <= emp.getId()) {
+            m_nextEmployeeId = emp.getId() + 1;
         }
+        return true;
+    }
+    if (op == "updateEmployee") {
+        return updateEmployeeById(record.value("id").toInt(-1), Employee::fromJson(record.value("employee").toObject()));
+    }
+    if (op == "deleteEmployee") {
+        return deleteEmployeeById(record.value("id").toInt(-1));
+    }
+    if (op == "addWorkLog") {
+        return addWorkLog(WorkLog::fromJson(record.value("log").toObject()));
+    }
+    if (op == "addWorkLogs") {
+        const QJsonArray logArray = record.value("logs").toArray();
+        QList<WorkLog> logs;
+        logs.reserve(logArray.size());
+        for (const QJsonValue &value : logArray) {
+            logs.append(WorkLog::fromJson(value.toObject()));
+        }
+        addWorkLogs(logs);
+        return true;
+    }
+    if (op == "updateWorkLog") {
+        return updateWorkLog(WorkLog::fromJson(record.value("old").toObject()),
+                             WorkLog::fromJson(record.value("log").toObject()));
+    }
+    if (op == "deleteWorkLog") {
+        return deleteWorkLog(record.value("employeeId").toInt(-1),
+                             QDate::fromString(record.value("date").toString(), Qt::ISODate));
+    }
+    if (op == "deleteWorkLogsOnDate") {
+        return deleteWorkLogsForEmployeeOnDate(record.value("employeeId").toInt(-1),
+                                               QDate::fromString(record.value("date").toString(), Qt::ISODate));
     }
     return false;
 }
@@ -1,17 +1,30 @@
 #ifndef DATAMANAGER_H
 #define DATAMANAGER_H
 
+#include <QObject>
 #include <QList>
-#include <QColor>
+#include <QHash>
+#include <QMap>
+#include <QVector>
 #include <QString>
+#include <QFuture>
 #include "employee.h"
 #include "worklog.h"
+#include "datajournal.h"
+#include "worklogcolumns.h"
+#include "worktimeindex.h"
+#include "datasnapshot.h"
+#include "binarysnapshot.h"
 
 // 프로그램의 모든 데이터(직원, 근무 기록)를 관리하는 클래스
-class DataManager
+// 데이터가 바뀌면 무엇이 바뀌었는지 알려주는 시그널을 보내므로, 화면들은 바뀐 부분만 다시 계산하면 됨
+class DataManager : public QObject
 {
+    Q_OBJECT
+
 public:
-    DataManager();
+    explicit DataManager(QObject *parent = nullptr);
+    ~DataManager();
 
     // --- 직원 관리 함수 ---
     void addEmployee(Employee &employee); // 새 직원 추가
@@ -19,29 +32,132 @@ public:
     bool deleteEmployeeById(int employeeId); // ID로 직원 삭제
     bool updateEmployeeById(int employeeId, const Employee &updatedEmployeeInfo); // ID로 직원 정보 수정
     Employee getEmployeeById(int employeeId) const; // ID로 특정 직원 정보 조회
+    // ID로 직원을 복사 없이 조회 (없으면 nullptr). 직원 추가/삭제 후에는 포인터가 무효화될 수 있음
+    const Employee* findEmployee(int employeeId) const;
 
     // --- 근무 기록 관리 함수 ---
-    void addWorkLog(const WorkLog &log); // 새 근무 기록 추가
+    // 새 근무 기록 추가 (날짜가 지원 기간(WorkTimeIndex 참고) 밖이면 추가하지 않고 false)
+    bool addWorkLog(const WorkLog &log);
+    // 여러 근무 기록을 한 번에 추가하고 추가한 건수를 반환 (지원 기간 밖의 기록은 건너뜀)
+    // 정렬과 근무 시간 색인 재구성은 직원마다 한 번, 저널 레코드는 하나, 알림은 직원마다 바뀐 날짜 범위로 한 번
+    int addWorkLogs(const QList<WorkLog> &logs);
     QList<WorkLog> getWorkLogsForEmployeeOnDate(int employeeId, const QDate &date) const; // 특정 직원의 특정 날짜 근무 기록 조회
-    QList<WorkLog> getWorkLogsForDate(const QDate &date) const; // 특정 날짜의 모든 근무 기록 조회
-    QList<WorkLog> getWorkLogsForEmployeeForMonth(int employeeId, int year, int month) const; // 특정 직원의 특정 월 근무 기록 조회
+    QList<WorkLog> getWorkLogsForDate(const QDate &date) const; // 특정 날짜의 모든 근무 기록 조회 (직원 목록 순서, 목록에 없는 ID는 뒤에 ID순)
+    // 특정 직원의 특정 월 / 기간(양 끝 포함) 근무 기록 조회 (날짜순)
+    // totalMinutes를 주면 조회한 기록들의 근무 분 합계를 같은 열 구간에서 집계 커널로 함께 계산해 넣음
+    QList<WorkLog> getWorkLogsForEmployeeForMonth(int employeeId, int year, int month, qint64 *totalMinutes = nullptr) const;
+    QList<WorkLog> getWorkLogsForEmployeeInRange(int employeeId, const QDate &startDate, const QDate &endDate,
+                                                 qint64 *totalMinutes = nullptr) const;
+    // 여러 직원의 특정 월 근무 기록을 날짜별로 묶어 반환 (결과[일 - 1], 같은 날 안에서는 employeeIds 순서)
+    QVector<QList<WorkLog>> getWorkLogsByDayForMonth(const QList<int> &employeeIds, int year, int month) const;
     bool deleteWorkLogsForEmployeeOnDate(int employeeId, const QDate& date); // 특정 직원의 특정 날짜 근무 기록 삭제
 
     // --- 데이터 저장/불러오기 ---
+    // 확장자가 .json이면 JSON(교환용), 그 외에는 바이너리 스냅샷 형식으로 저장
     bool saveData(const QString &filename) const; // 모든 데이터를 파일에 저장
-    bool loadData(const QString &filename); // 파일에서 데이터 불러오기
+    bool loadData(const QString &filename); // 파일에서 데이터 불러오기 (형식은 파일 내용으로 자동 판별)
+
+    // 마지막 JSON 불러오기의 단계별 소요 시간 (밀리초)
+    struct LoadStatistics {
+        qint64 fileBytes = 0;
+        int workLogCount = 0;
+        int threadCount = 1;   // 1이면 스트리밍(단일 스레드) 경로
+        int chunkCount = 0;    // 병렬 파싱에 쓴 청크 수
+        qint64 scanMs = 0;     // 원소 경계 찾기
+        qint64 parseMs = 0;    // 근무 기록 파싱
+        qint64 mergeMs = 0;    // 청크 결과를 파일 순서대로 합치기
+        qint64 indexMs = 0;    // 직원별 날짜순 정렬
+        int secondsDroppedCount = 0; // 출퇴근 시각의 초가 0이 아니어서 분 단위로 잘린 근무 기록 수
+        qint64 totalMs = 0;
+    };
+    const LoadStatistics &lastLoadStatistics() const;
+
+    // --- 저널 기반 저장소 (스냅샷 + 변경 기록) ---
+    // 스냅샷에 반영되지 않은 저널 레코드가 이만큼 쌓이면 스냅샷을 새로 씀 (이전 실행에서 쌓인 레코드 포함)
+    static constexpr int kJournalCompactionThreshold = 2000;
+    enum StoreMode {
+        ReadWrite, // 이후 변경을 저널에 기록
+        ReadOnly   // 읽기만 함 (저널 파일을 열거나 만들지 않음, 명령줄 급여 계산용)
+    };
+    // 스냅샷을 불러오고 그 뒤의 저널을 재생한 다음, 이후 변경은 한 건씩 저널에 덧붙임
+    bool openStore(const QString &snapshotPath, StoreMode mode = ReadWrite);
+    // 진행 중인 백그라운드 압축을 기다리고 저널을 닫음
+    // 쌓인 레코드가 압축 기준 이상이면 닫기 전에 스냅샷을 새로 씀
+    void closeStore();
+    // 현재 상태로 스냅샷을 다시 쓰고 저널을 비움 (완료될 때까지 기다림)
+    bool compactStore();
 
     // --- 개별 근무 기록 관리 ---
     WorkLog getWorkLogByEmployeeAndDate(int employeeId, const QDate& date) const; // 특정 직원의 특정 날짜 근무 기록 찾기
-    bool updateWorkLog(const WorkLog& oldLog, const WorkLog& newLog); // 근무 기록 수정
+    bool updateWorkLog(const WorkLog& oldLog, const WorkLog& newLog); // 근무 기록 수정 (새 날짜가 지원 기간 밖이면 false)
     bool deleteWorkLog(int employeeId, const QDate& date); // 근무 기록 삭제
-    const QList<WorkLog>& getWorkLogs() const; // 모든 근무 기록 목록 반환
+    // 모든 근무 기록 목록 반환
+    // 순서: 직원 ID 오름차순, 같은 직원 안에서는 날짜순, 같은 날짜는 입력 순서
+    // (입력 순서 전체를 보존하지는 않음. 저장 파일의 근무 기록도 이 순서로 기록됨)
+    const QList<WorkLog>& getWorkLogs() const;
+
+    // --- 근무 시간 집계 ---
+    // 특정 직원의 기간(양 끝 포함) 총 근무 시간(분) - 누적 합 색인으로 O(log n)
+    qint64 getTotalMinutesForEmployee(int employeeId, const QDate &startDate, const QDate &endDate) const;
+    // 특정 직원의 기간 내 주별 근무 시간(분) (키: 그 주 월요일, 기간 밖의 날은 제외)
+    // 주 단위 합계 색인을 쓰므로 비용은 기간에 걸친 주의 수에 비례
+    QMap<QDate, qint64> getWeeklyMinutesForEmployee(int employeeId, const QDate &startDate, const QDate &endDate) const;
+
+    // 현재 직원 목록과 근무 시간 색인의 읽기 전용 사본 (작업 스레드의 급여 계산용)
+    // 암시적 공유로 만들기 때문에 비용은 참조 카운트 증가 정도
+    DataSnapshot snapshot() const;
+
+signals:
+    void employeeAdded(int employeeId);   // 직원 추가됨
+    void employeeUpdated(int employeeId); // 직원 이름/시급/계좌 변경됨
+    void employeeRemoved(int employeeId); // 직원 삭제됨 (그 직원의 근무 기록도 함께 삭제됨)
+    // 특정 직원의 [fromDate, toDate] 사이 근무 기록이 추가/수정/삭제됨
+    void workLogsChanged(int employeeId, const QDate &fromDate, const QDate &toDate);
+    // 파일 불러오기나 저장소 열기로 데이터 전체가 바뀜 (화면 전체를 다시 그려야 함)
+    void dataReset();
 
 private:
-    QList<Employee> m_employees; // 직원 목록
-    QList<WorkLog> m_workLogs;   // 근무 기록 목록
-    QList<QColor> m_employeeColorCycle; // 직원별 색상 (현재 미사용)
+    void insertWorkLogIntoIndex(const WorkLog &log); // 색인의 날짜 순서를 유지하며 근무 기록 삽입
+    void invalidateWorkLogCache(); // 전체 근무 기록 목록 캐시 무효화
+    void rebuildEmployeeSlots(int fromSlot = 0); // fromSlot 이후 직원들의 ID → 위치 색인 재구성
+    void sortWorkLogIndex(bool parallel = false); // 직원별 근무 기록 열을 날짜순으로 정렬
+    int removeUnsupportedWorkLogs(); // 불러온 근무 기록 중 지원 기간 밖의 기록을 버림
+    void rebuildWorkTimeIndex(); // 정렬된 근무 기록으로 직원별 근무 시간 누적 합 색인을 다시 만듦
+    bool loadBinarySnapshot(const QString &filename); // 바이너리 스냅샷에서 데이터 불러오기
+    bool loadJsonSnapshot(const QString &filename); // JSON 스냅샷을 스트리밍으로 불러오기
+
+    // --- 저널 관련 헬퍼 함수 ---
+    void appendJournal(const QJsonObject &record); // 저장소가 열려 있으면 변경 레코드 기록
+    bool applyJournalRecord(const QJsonObject &record); // 저널 레코드 하나를 메모리 데이터에 반영
+    bool startBackgroundCompaction(); // 저널을 회전시키고 스냅샷 저장을 작업 스레드에서 실행
+    // 직원별 근무 기록 열을 getWorkLogs()와 같은 순서로 하나씩 넘기는 저장용 원본 (전체 목록을 만들지 않음)
+    // 열 해시는 값으로 잡아 두므로(암시적 공유) 작업 스레드에서 쓰는 동안 원본이 바뀌어도 영향 없음
+    static BinarySnapshot::WorkLogSource workLogSource(const QHash<int, WorkLogColumns> &columnsByEmployee,
+                                                       qint64 *workLogCount);
+    // 주어진 데이터로 스냅샷 파일을 원자적으로 기록 (형식은 파일 확장자로 결정)
+    static bool writeSnapshot(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                              const QList<Employee> &employees, qint64 workLogCount,
+                              const BinarySnapshot::WorkLogSource &source);
+    static bool writeJsonSnapshot(const QString &filename, int nextEmployeeId, qint64 journalSequence,
+                                  const QList<Employee> &employees, const BinarySnapshot::WorkLogSource &source);
+
+    QList<Employee> m_employees; // 직원 목록 (입력 순서 유지)
+    QHash<int, int> m_employeeSlotById; // 직원 ID → m_employees 내 위치
+    // 직원 ID별 근무 기록 열 저장소 (각 열은 날짜순 정렬, 같은 날짜는 입력 순서 유지)
+    // 바깥에는 WorkLog 값으로 돌려주고, 안에서는 날짜/분 배열만 보관함
+    QHash<int, WorkLogColumns> m_workLogsByEmployee;
+    // getWorkLogs()용 전체 근무 기록 목록 (색인에서 필요할 때만 다시 만듦)
+    mutable QList<WorkLog> m_workLogs;
+    mutable bool m_workLogCacheValid;
+    // 직원 ID별 일별 근무 시간 누적 합 색인 (근무 기록 추가/수정/삭제 시 함께 갱신)
+    QHash<int, WorkTimeIndex> m_workTimeByEmployee;
     int m_nextEmployeeId;        // 다음 직원에게 할당할 ID
+
+    DataJournal m_journal;        // 변경 기록 저널
+    QString m_snapshotPath;       // 저널과 짝을 이루는 스냅샷 파일 경로 (openStore 전에는 비어 있음)
+    qint64 m_snapshotSequence;    // 마지막으로 불러온 스냅샷에 반영된 저널 순번
+    QFuture<bool> m_compaction;   // 진행 중인 백그라운드 압축 작업
+    LoadStatistics m_lastLoadStatistics; // 마지막 JSON 불러오기 통계
 };
 
 #endif // DATAMANAGER_H
@@ -0,0 +1,27 @@
+#include "datasnapshot.h"
+
+DataSnapshot::DataSnapshot(const QList<Employee> &employees, const QHash<int, int> &employeeSlotById,
+                           const QHash<int, WorkTimeIndex> &workTimeByEmployee)
+    : m_employees(employees), m_employeeSlotById(employeeSlotById), m_workTimeByEmployee(workTimeByEmployee)
+{
+}
+
+const QList<Employee> &DataSnapshot::employees() const
+{
+    return m_employees;
+}
+
+const Employee *DataSnapshot::findEmployee(int employeeId) const
+{
+    auto slotIt = m_employeeSlotById.constFind(employeeId);
+    if (slotIt == m_employeeSlotById.constEnd()) {
+        return nullptr;
+    }
+    return &m_employees.at(slotIt.value());
+}
+
+const WorkTimeIndex *DataSnapshot::findWorkTimeIndex(int employeeId) const
+{
+    auto it = m_workTimeByEmployee.constFind(employeeId);
+    return it != m_workTimeByEmployee.constEnd() ? &it.value() : nullptr;
+}
@@ -0,0 +1,30 @@
+#ifndef DATASNAPSHOT_H
+#define DATASNAPSHOT_H
+
+#include <QHash>
+#include <QList>
+#include "employee.h"
+#include "worktimeindex.h"
+
+// 특정 시점의 직원 목록과 근무 시간 색인을 묶은 읽기 전용 사본
+// Qt 컨테이너의 암시적 공유(copy-on-write) 덕분에 만들 때는 참조 카운트만 늘고,
+// 이후 DataManager가 데이터를 고치면 바뀐 부분만 그쪽에서 복사됨
+// 작업 스레드에 넘겨도 원본과 메모리를 함께 쓰지 않으므로 잠금 없이 읽을 수 있음
+class DataSnapshot
+{
+public:
+    DataSnapshot() = default;
+    DataSnapshot(const QList<Employee> &employees, const QHash<int, int> &employeeSlotById,
+                 const QHash<int, WorkTimeIndex> &workTimeByEmployee);
+
+    const QList<Employee> &employees() const;
+    const Employee *findEmployee(int employeeId) const; // 없으면 nullptr
+    const WorkTimeIndex *findWorkTimeIndex(int employeeId) const; // 근무 기록이 없으면 nullptr
+
+private:
+    QList<Employee> m_employees;
+    QHash<int, int> m_employeeSlotById;
+    QHash<int, WorkTimeIndex> m_workTimeByEmployee;
+};
+
+#endif // DATASNAPSHOT_H
@@ -2,7 +2,7 @@
 #include "employee.h"
 
 // 생성자: 직원 객체의 멤버 변수들을 초기화
-Employee::Employee(int id, const QString &name, int hourlyWage, const QString &account, const QColor &color)
+Employee::Employee(int id, const QString &name, int hourlyWage, const QString &account)
     : m_id(id), // m_id 멤버 초기화 추가!
     m_name(name),
     m_hourlyWage(hourlyWage),
@@ -2,7 +2,6 @@
 #define EMPLOYEE_H
 
 #include <QString>
-#include <QColor>
 #include <QJsonObject>
 #include <QJsonValue>
 
@@ -11,7 +10,7 @@ class Employee
 {
 public:
     // 생성자: 직원 객체를 초기화
-    Employee(int id = -1, const QString &name = "", int hourlyWage = 0, const QString &account = "", const QColor &color = Qt::black);
+    Employee(int id = -1, const QString &name = "", int hourlyWage = 0, const QString &account = "");
 
     // --- 정보 가져오기 (Getter) ---
     int getId() const;
@@ -0,0 +1,221 @@
+#include "employeelistmodel.h"
+#include "datamanager.h"
+#include "tracing.h"
+
+EmployeeListModel::EmployeeListModel(DataManager *dataManager, QObject *parent)
+    : QAbstractListModel(parent), m_dataManager(dataManager)
+{
+    if (m_dataManager) {
+        connect(m_dataManager, &DataManager::employeeAdded, this, &EmployeeListModel::onEmployeeAdded);
+        connect(m_dataManager, &DataManager::employeeUpdated, this, &EmployeeListModel::onEmployeeUpdated);
+        connect(m_dataManager, &DataManager::employeeRemoved, this, &EmployeeListModel::onEmployeeRemoved);
+        connect(m_dataManager, &DataManager::dataReset, this, &EmployeeListModel::onDataReset);
+
+        const QList<Employee> &employees = m_dataManager->getEmployees();
+        m_employeeIds.reserve(employees.size());
+        for (const Employee &emp : employees) {
+            m_employeeIds.append(emp.getId());
+        }
+        rebuildRowIndex();
+    }
+}
+
+int EmployeeListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_employeeIds.size();
+}
+
+QVariant EmployeeListModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_employeeIds.size()) return QVariant();
+
+    const int employeeId = m_employeeIds.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole: {
+        const Employee *emp = m_dataManager->findEmployee(employeeId);
+        return emp ? emp->getName() : QString();
+    }
+    case Qt::CheckStateRole:
+        return m_checkedIds.contains(employeeId) ? Qt::Checked : Qt::Unchecked;
+    case EmployeeIdRole:
+        return employeeId;
+    default:
+        return QVariant();
+    }
+}
+
+bool EmployeeListModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid() || role != Qt::CheckStateRole || index.row() >= m_employeeIds.size()) return false;
+
+    setChecked(m_employeeIds.at(index.row()), value.toInt() == Qt::Checked);
+    return true;
+}
+
+Qt::ItemFlags EmployeeListModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid()) return Qt::NoItemFlags;
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsUserCheckable | Qt::ItemNeverHasChildren;
+}
+
+int EmployeeListModel::employeeIdAt(int row) const
+{
+    return (row >= 0 && row < m_employeeIds.size()) ? m_employeeIds.at(row) : -1;
+}
+
+QList<int> EmployeeListModel::checkedEmployeeIds() const
+{
+    QList<int> checkedIds;
+    if (m_checkedIds.isEmpty()) return checkedIds;
+
+    checkedIds.reserve(m_checkedIds.size());
+    for (int employeeId : m_employeeIds) {
+        if (m_checkedIds.contains(employeeId)) {
+            checkedIds.append(employeeId);
+        }
+    }
+    return checkedIds;
+}
+
+int EmployeeListModel::checkedCount() const
+{
+    return m_checkedIds.size();
+}
+
+bool EmployeeListModel::isChecked(int employeeId) const
+{
+    return m_checkedIds.contains(employeeId);
+}
+
+void EmployeeListModel::setChecked(int employeeId, bool checked)
+{
+    int row = rowOf(employeeId);
+    if (row < 0 || m_checkedIds.contains(employeeId) == checked) return;
+
+    if (checked) {
+        m_checkedIds.insert(employeeId);
+    } else {
+        m_checkedIds.remove(employeeId);
+    }
+    const QModelIndex changed = index(row);
+    emit dataChanged(changed, changed, {Qt::CheckStateRole});
+    emit checkedEmployeesChanged();
+}
+
+void EmployeeListModel::checkAll()
+{
+    replaceCheckedSet(QSet<int>(m_employeeIds.cbegin(), m_employeeIds.cend()));
+}
+
+void EmployeeListModel::checkNone()
+{
+    replaceCheckedSet(QSet<int>());
+}
+
+void EmployeeListModel::invertChecks()
+{
+    QSet<int> inverted;
+    inverted.reserve(m_employeeIds.size() - m_checkedIds.size());
+    for (int employeeId : m_employeeIds) {
+        if (!m_checkedIds.contains(employeeId)) {
+            inverted.insert(employeeId);
+        }
+    }
+    replaceCheckedSet(inverted);
+}
+
+void EmployeeListModel::checkMatching(const QString &filter)
+{
+    QSet<int> matching;
+    for (int employeeId : m_employeeIds) {
+        const Employee *emp = m_dataManager->findEmployee(employeeId);
+        if (emp && emp->getName().contains(filter, Qt::CaseInsensitive)) {
+            matching.insert(employeeId);
+        }
+    }
+    replaceCheckedSet(matching);
+}
+
+void EmployeeListModel::replaceCheckedSet(const QSet<int> &checkedIds)
+{
+    if (checkedIds == m_checkedIds) return;
+
+    m_checkedIds = checkedIds;
+    if (!m_employeeIds.isEmpty()) {
+        emit dataChanged(index(0), index(m_employeeIds.size() - 1), {Qt::CheckStateRole});
+    }
+    emit checkedEmployeesChanged();
+}
+
+int EmployeeListModel::rowOf(int employeeId) const
+{
+    return m_rowById.value(employeeId, -1);
+}
+
+void EmployeeListModel::rebuildRowIndex(int fromRow)
+{
+    if (fromRow == 0) {
+        m_rowById.clear();
+        m_rowById.reserve(m_employeeIds.size());
+    }
+    for (int i = fromRow; i < m_employeeIds.size(); ++i) {
+        m_rowById.insert(m_employeeIds.at(i), i);
+    }
+}
+
+// DataManager는 새 직원을 목록 끝에 붙이므로 마지막 행으로 추가
+void EmployeeListModel::onEmployeeAdded(int employeeId)
+{
+    const int row = m_employeeIds.size();
+    beginInsertRows(QModelIndex(), row, row);
+    m_employeeIds.append(employeeId);
+    m_rowById.insert(employeeId, row);
+    endInsertRows();
+}
+
+void EmployeeListModel::onEmployeeUpdated(int employeeId)
+{
+    int row = rowOf(employeeId);
+    if (row < 0) return;
+
+    const QModelIndex changed = index(row);
+    emit dataChanged(changed, changed, {Qt::DisplayRole});
+}
+
+void EmployeeListModel::onEmployeeRemoved(int employeeId)
+{
+    int row = rowOf(employeeId);
+    if (row < 0) return;
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_employeeIds.removeAt(row);
+    m_rowById.remove(employeeId);
+    rebuildRowIndex(row); // 뒤쪽 행들의 번호가 하나씩 당겨짐
+    endRemoveRows();
+
+    if (m_checkedIds.remove(employeeId)) {
+        emit checkedEmployeesChanged();
+    }
+}
+
+// 데이터 전체가 바뀌면 목록을 다시 읽고 체크 상태는 모두 해제
+void EmployeeListModel::onDataReset()
+{
+    TRACE_SCOPE("EmployeeListModel::onDataReset");
+    const bool hadChecks = !m_checkedIds.isEmpty();
+
+    beginResetModel();
+    m_employeeIds.clear();
+    m_checkedIds.clear();
+    const QList<Employee> &employees = m_dataManager->getEmployees();
+    m_employeeIds.reserve(employees.size());
+    for (const Employee &emp : employees) {
+        m_employeeIds.append(emp.getId());
+    }
+    rebuildRowIndex();
+    endResetModel();
+
+    if (hadChecks) {
+        emit checkedEmployeesChanged();
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef EMPLOYEELISTMODEL_H
+#define EMPLOYEELISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+
+class DataManager;
+
+// 직원 패널용 목록 모델 (DataManager의 직원 목록 순서를 그대로 따름)
+// 체크 상태는 항목마다 두지 않고 체크된 직원 ID 집합으로 관리하므로,
+// 전체 선택/해제/반전/필터 선택 같은 일괄 작업도 변경 알림을 한 번만 보냄
+class EmployeeListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Roles {
+        EmployeeIdRole = Qt::UserRole // 직원 고유 ID
+    };
+
+    explicit EmployeeListModel(DataManager *dataManager, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    int employeeIdAt(int row) const; // 해당 행의 직원 ID (범위 밖이면 -1)
+    QList<int> checkedEmployeeIds() const; // 체크된 직원 ID (목록 순서)
+    int checkedCount() const;
+    bool isChecked(int employeeId) const;
+
+    // --- 체크 상태 변경 (실제로 바뀐 경우에만 checkedEmployeesChanged를 한 번 보냄) ---
+    void setChecked(int employeeId, bool checked);
+    void checkAll();
+    void checkNone();
+    void invertChecks();
+    // 이름에 filter가 들어간 직원만 체크 (대소문자 무시, 나머지는 해제)
+    void checkMatching(const QString &filter);
+
+signals:
+    // 체크된 직원 집합이 바뀌었을 때 (일괄 작업도 한 번만 발생)
+    void checkedEmployeesChanged();
+
+private slots:
+    void onEmployeeAdded(int employeeId);
+    void onEmployeeUpdated(int employeeId);
+    void onEmployeeRemoved(int employeeId);
+    void onDataReset();
+
+private:
+    int rowOf(int employeeId) const; // 직원 ID의 행 번호 (없으면 -1), O(1)
+    void rebuildRowIndex(int fromRow = 0); // fromRow 이후 행들의 직원 ID → 행 번호 색인 재구성
+    void replaceCheckedSet(const QSet<int> &checkedIds); // 체크 집합을 통째로 바꾸고 한 번만 알림
+
+    DataManager *m_dataManager;
+    QList<int> m_employeeIds; // 행 순서대로의 직원 ID (DataManager 목록과 같은 순서)
+    QHash<int, int> m_rowById; // 직원 ID → m_employeeIds 안의 행 번호
+    QSet<int> m_checkedIds;   // 체크된 직원 ID
+};
+
+#endif // EMPLOYEELISTMODEL_H
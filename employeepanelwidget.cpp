@@ -2,7 +2,10 @@
 #include "ui_employeepanelwidget.h"
 #include "addemployeedialog.h"
 #include "employee.h"
-#include <QListWidgetItem>
+#include "employeelistmodel.h"
+#include "logging.h"
+#include <QInputDialog>
+#include <QMenu>
 #include <QMessageBox>
 #include <QDebug>     // 디버깅용 출력
 
@@ -10,16 +13,24 @@
 EmployeePanelWidget::EmployeePanelWidget(DataManager *dataManager, QWidget *parent) :
     QWidget(parent),
     ui(new Ui::EmployeePanelWidget),
-    m_dataManager(dataManager)
+    m_dataManager(dataManager),
+    m_employeeModel(new EmployeeListModel(dataManager, this)),
+    m_deferButtonStateUpdate(false)
 {
     ui->setupUi(this);
 
-    // 직원 체크박스 상태가 바뀔 때 버튼 상태를 갱신
-    connect(ui->employeeListWidget, &QListWidget::itemChanged,
-            this, &EmployeePanelWidget::on_employeeListWidget_itemChanged);
+    // 직원 목록 모델 연결 (직원 추가/수정/삭제는 모델이 DataManager 알림으로 직접 반영)
+    // 뷰는 .ui에서 uniformItemSizes가 켜져 있어 행이 많아도 보이는 행만 측정함
+    ui->employeeListView->setModel(m_employeeModel);
+    ui->employeeListView->setContextMenuPolicy(Qt::CustomContextMenu);
+    connect(ui->employeeListView, &QListView::customContextMenuRequested,
+            this, &EmployeePanelWidget::showCheckMenu);
+
+    // 직원 체크 상태가 바뀔 때 버튼 상태를 갱신
+    connect(m_employeeModel, &EmployeeListModel::checkedEmployeesChanged,
+            this, &EmployeePanelWidget::onCheckedEmployeesChanged);
 
     updateButtonStates();      // 버튼 활성화/비활성화 상태 초기화
-    refreshEmployeeList();     // 직원 목록 로드
 }
 
 // 소멸자: UI 리소스 해제
@@ -38,12 +49,8 @@ void EmployeePanelWidget::on_addEmployeeButton_clicked()
         // 입력된 정보로 새 직원 데이터 생성
         Employee newEmployeeData = dialog.getEmployeeDetails();
 
-        // DataManager에 직원 추가
+        // DataManager에 직원 추가 (목록과 다른 화면은 employeeAdded 알림으로 갱신됨)
         m_dataManager->addEmployee(newEmployeeData);
-
-        // 목록 새로고침 및 변경 시그널 발생
-        refreshEmployeeList();
-        emit employeeListChanged();
     }
 }
 
@@ -78,10 +85,7 @@ void EmployeePanelWidget::on_editEmployeeButton_clicked()
         // 직원 정보 업데이트 시도
         bool success = m_dataManager->updateEmployeeById(employeeIdToEdit, updatedEmployeeData);
 
-        if (success) {
-            refreshEmployeeList();
-            emit employeeListChanged();
-        } else {
+        if (!success) {
             QMessageBox::warning(this, "수정 실패", "직원 정보 수정에 실패했습니다.");
         }
     }
@@ -108,21 +112,21 @@ void EmployeePanelWidget::on_deleteEmployeeButton_clicked()
     if (reply == QMessageBox::Yes) {
         bool allSucceeded = true;
 
-        // 선택된 직원들을 하나씩 삭제
+        // 선택된 직원들을 하나씩 삭제 (체크 변경 알림은 끝난 뒤 한 번만 보냄)
+        m_deferButtonStateUpdate = true;
         for (int id : checkedIds) {
             if (!m_dataManager->deleteEmployeeById(id)) {
                 allSucceeded = false;
-                qWarning() << "Failed to delete employee with ID:" << id;
+                qCWarning(lcEmployeePanel) << "Failed to delete employee with ID:" << id;
             }
         }
+        m_deferButtonStateUpdate = false;
+        updateButtonStates();
 
         // 일부 실패 시 경고
         if (!allSucceeded) {
             QMessageBox::warning(this, "삭제 오류", "일부 직원 정보 삭제에 실패했습니다.");
         }
-
-        refreshEmployeeList();
-        emit employeeListChanged();
     }
 }
 
@@ -136,55 +140,49 @@ void EmployeePanelWidget::updateButtonStates()
     // 삭제 버튼은 하나 이상 선택되면 활성화
     ui->deleteEmployeeButton->setEnabled(!checkedIds.isEmpty());
 
-    qDebug() << "EmployeePanelWidget: Emitting checkedEmployeesChanged with IDs:" << checkedIds;
+    LOG_HOT(lcEmployeePanel) << "Emitting checkedEmployeesChanged with IDs:" << checkedIds;
     emit checkedEmployeesChanged(checkedIds); // 시그널 발신 (예: 근무 기록 연동 등)
 }
 
-// 직원 목록 새로고침 (리스트를 재구성)
-void EmployeePanelWidget::refreshEmployeeList()
+// 체크된 직원들의 ID를 반환 (목록 순서)
+QList<int> EmployeePanelWidget::getCheckedEmployeeIds() const
 {
-    if (!m_dataManager) return;
-
-    ui->employeeListWidget->clear(); // 기존 항목 제거
-    const QList<Employee>& employees = m_dataManager->getEmployees(); // 전체 직원 목록 가져오기
-
-    for (const Employee& emp : employees) {
-        QListWidgetItem *item = new QListWidgetItem();
-
-        item->setFlags(item->flags() | Qt::ItemIsUserCheckable); // 체크 가능하게 설정
-        item->setCheckState(Qt::Unchecked); // 초기 상태는 체크 안 됨
-
-        item->setData(Qt::UserRole, emp.getId()); // UserRole에 직원 고유 ID 저장
-        item->setText(emp.getName()); // 항목 텍스트로 이름 설정
+    return m_employeeModel->checkedEmployeeIds();
+}
 
-        ui->employeeListWidget->addItem(item);
-    }
+EmployeeListModel *EmployeePanelWidget::employeeModel() const
+{
+    return m_employeeModel;
+}
 
+// 모델의 체크 상태가 바뀌었을 때 실행되는 슬롯
+void EmployeePanelWidget::onCheckedEmployeesChanged()
+{
+    if (m_deferButtonStateUpdate) return; // 일괄 삭제가 끝난 뒤 한 번만 갱신
     updateButtonStates(); // 버튼 상태 업데이트
 }
 
-// 체크된 직원들의 ID를 반환
-QList<int> EmployeePanelWidget::getCheckedEmployeeIds() const
+// 목록 우클릭 메뉴: 일괄 체크 작업 (어떤 작업이든 체크 변경 알림은 한 번만 나감)
+void EmployeePanelWidget::showCheckMenu(const QPoint &pos)
 {
-    QList<int> checkedIds;
-
-    for (int i = 0; i < ui->employeeListWidget->count(); ++i) {
-        QListWidgetItem *item = ui->employeeListWidget->item(i);
-        if (item && item->checkState() == Qt::Checked) {
-            bool ok;
-            int id = item->data(Qt::UserRole).toInt(&ok); // 저장된 ID 가져오기
-            if (ok) {
-                checkedIds.append(id);
-            }
+    QMenu menu(this);
+    QAction *checkAllAction = menu.addAction("전체 선택");
+    QAction *checkNoneAction = menu.addAction("전체 해제");
+    QAction *invertAction = menu.addAction("선택 반전");
+    QAction *filterAction = menu.addAction("이름으로 선택...");
+
+    QAction *chosen = menu.exec(ui->employeeListView->viewport()->mapToGlobal(pos));
+    if (chosen == checkAllAction) {
+        m_employeeModel->checkAll();
+    } else if (chosen == checkNoneAction) {
+        m_employeeModel->checkNone();
+    } else if (chosen == invertAction) {
+        m_employeeModel->invertChecks();
+    } else if (chosen == filterAction) {
+        bool ok = false;
+        QString filter = QInputDialog::getText(this, "이름으로 선택", "이름에 포함된 글자:", QLineEdit::Normal, QString(), &ok);
+        if (ok && !filter.isEmpty()) {
+            m_employeeModel->checkMatching(filter);
         }
     }
-
-    return checkedIds;
-}
-
-// 직원 리스트 아이템의 체크 상태가 바뀔 때 실행되는 슬롯
-void EmployeePanelWidget::on_employeeListWidget_itemChanged(QListWidgetItem *item)
-{
-    Q_UNUSED(item); // item 변수는 사용하지 않음
-    updateButtonStates(); // 버튼 상태 업데이트
 }
@@ -5,7 +5,7 @@
 #include <QList>
 #include "datamanager.h"
 
-class QListWidgetItem;
+class EmployeeListModel;
 
 namespace Ui {
 class EmployeePanelWidget;
@@ -20,18 +20,13 @@ public:
     explicit EmployeePanelWidget(DataManager *dataManager, QWidget *parent = nullptr);
     ~EmployeePanelWidget();
 
-    // 직원 목록 UI를 최신 데이터로 새로고침
-    void refreshEmployeeList();
-    QList<int> getCheckedEmployeeIndices() const;
     // UI에서 현재 체크된 직원들의 ID 목록을 가져옴
     QList<int> getCheckedEmployeeIds() const;
-    int getSelectedEmployeeIndex() const ;
+    EmployeeListModel *employeeModel() const; // 목록 모델 (일괄 체크 작업용)
 
 signals:
     // 체크된 직원 목록이 변경될 때 발생하는 신호
     void checkedEmployeesChanged(const QList<int>& checkedIndices);
-    // 직원 목록 자체가 변경(추가/삭제)될 때 발생하는 신호
-    void employeeListChanged();
 
 private slots:
     // '직원 추가' 버튼 클릭 시 실행
@@ -40,12 +35,16 @@ private slots:
     void on_editEmployeeButton_clicked();
     // '직원 삭제' 버튼 클릭 시 실행
     void on_deleteEmployeeButton_clicked();
-    // 목록에서 아이템의 체크 상태가 바뀔 때 실행
-    void on_employeeListWidget_itemChanged(QListWidgetItem *item);
+    // 모델의 체크 상태가 바뀔 때 실행 (일괄 작업도 한 번만 호출됨)
+    void onCheckedEmployeesChanged();
+    // 목록 우클릭 메뉴: 전체 선택/해제/반전/이름으로 선택
+    void showCheckMenu(const QPoint &pos);
 
 private:
     Ui::EmployeePanelWidget *ui; // UI 요소 관리 포인터
     DataManager *m_dataManager; // 데이터 관리자 포인터
+    EmployeeListModel *m_employeeModel; // 직원 목록과 체크 상태를 가진 모델
+    bool m_deferButtonStateUpdate; // 여러 직원을 한꺼번에 삭제하는 동안 체크 변경 알림을 미룸
     // 버튼 활성화/비활성화 상태 업데이트
     void updateButtonStates();
 };
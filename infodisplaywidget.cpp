@@ -1,12 +1,15 @@
 #include "infodisplaywidget.h"
 #include "employee.h"
 #include "worklog.h"
+#include "tracing.h"
 #include <QDebug>
 #include <QLocale>
+#include <QSignalBlocker>
 
 // 생성자: 시작일과 종료일을 현재 월로 초기화하고 UI를 구성
 InfoDisplayWidget::InfoDisplayWidget(DataManager* dataManager, QWidget *parent)
-    : QWidget(parent), m_dataManager(dataManager)
+    : QWidget(parent), m_dataManager(dataManager), m_currentEmployeeId(-1),
+      m_payrollCalculator(new PayrollCalculator(this)), m_pendingPartial(false)
 {
     QFont font = this->font();
     font.setPointSize(14);  // 폰트 크기 키움
@@ -16,6 +19,15 @@ InfoDisplayWidget::InfoDisplayWidget(DataManager* dataManager, QWidget *parent)
     m_startDate = QDate(today.year(), today.month(), 1);
     m_endDate = QDate(today.year(), today.month(), today.daysInMonth());
 
+    connect(m_payrollCalculator, &PayrollCalculator::resultReady, this, &InfoDisplayWidget::onPayrollReady);
+
+    // 데이터 변경 알림 연결
+    connect(m_dataManager, &DataManager::employeeAdded, this, &InfoDisplayWidget::onEmployeeAdded);
+    connect(m_dataManager, &DataManager::employeeUpdated, this, &InfoDisplayWidget::onEmployeeUpdated);
+    connect(m_dataManager, &DataManager::employeeRemoved, this, &InfoDisplayWidget::onEmployeeRemoved);
+    connect(m_dataManager, &DataManager::workLogsChanged, this, &InfoDisplayWidget::onWorkLogsChanged);
+    connect(m_dataManager, &DataManager::dataReset, this, &InfoDisplayWidget::refreshEmployeeTabs);
+
     setupUI();
     refreshEmployeeTabs();
 }
@@ -46,42 +58,66 @@ void InfoDisplayWidget::setupUI()
 
     connect(m_updateButton, &QPushButton::clicked, this, &InfoDisplayWidget::onPeriodChanged);
 
-    // 직원별 정보 및 집계 탭
-    m_tabWidget = new QTabWidget();
+    // 직원별 정보 및 집계 탭 (탭 바 + 공용 페이지 두 장)
+    m_tabBar = new QTabBar();
+    m_tabBar->setExpanding(false);
+    m_tabBar->setUsesScrollButtons(true);
+    m_employeePage = createEmployeePage();
+    m_aggregatePage = createAggregateTab();
+    m_pageStack = new QStackedWidget();
+    m_pageStack->addWidget(m_employeePage);
+    m_pageStack->addWidget(m_aggregatePage);
+
+    connect(m_tabBar, &QTabBar::currentChanged, this, &InfoDisplayWidget::onCurrentTabChanged);
 
     mainLayout->addWidget(periodGroup);
-    mainLayout->addWidget(m_tabWidget);
+    mainLayout->addWidget(m_tabBar);
+    mainLayout->addWidget(m_pageStack);
 }
 
-// 직원별 탭과 집계 탭 생성 및 초기화
+// 직원별 탭과 집계 탭 생성 및 초기화 (탭 바 항목만 만들고 페이지는 공용)
 void InfoDisplayWidget::refreshEmployeeTabs()
 {
-    m_tabWidget->clear();  // 기존 탭 제거
-    m_employeeTabWidgets.clear();
+    TRACE_SCOPE("InfoDisplayWidget::refreshEmployeeTabs");
+    const int previousEmployeeId = m_currentEmployeeId;
+    {
+        QSignalBlocker blocker(m_tabBar);
+        while (m_tabBar->count() > 0) {
+            m_tabBar->removeTab(0);
+        }
+
+        const QList<Employee>& employees = m_dataManager->getEmployees();
+
+        // 직원별 탭 추가
+        for (const Employee& emp : employees) {
+            int index = m_tabBar->addTab(emp.getName());
+            m_tabBar->setTabData(index, emp.getId());
+        }
 
-    const QList<Employee>& employees = m_dataManager->getEmployees();
+        // 집계 탭 추가
+        int aggregateIndex = m_tabBar->addTab("집계");
+        m_tabBar->setTabData(aggregateIndex, -1);
+        rebuildTabIndex();
 
-    // 직원별 탭 추가
-    for (const Employee& emp : employees) {
-        QWidget* employeeTab = createEmployeeTab(emp.getId());
-        m_tabWidget->addTab(employeeTab, emp.getName());
+        // 보고 있던 직원이 남아 있으면 그 탭을 유지
+        int currentIndex = tabIndexForEmployee(previousEmployeeId);
+        m_tabBar->setCurrentIndex(currentIndex >= 0 ? currentIndex : 0);
     }
 
-    // 집계 탭 추가
-    QWidget* aggregateTab = createAggregateTab();
-    m_tabWidget->addTab(aggregateTab, "집계");
+    const int currentIndex = m_tabBar->currentIndex();
+    m_currentEmployeeId = currentIndex >= 0 ? m_tabBar->tabData(currentIndex).toInt() : -1;
+    m_pageStack->setCurrentWidget(m_currentEmployeeId >= 0 ? m_employeePage : m_aggregatePage);
 
     updateAllTabs();
 }
 
-// 직원별 개별 탭 생성
-QWidget* InfoDisplayWidget::createEmployeeTab(int employeeId)
+// 모든 직원 탭이 함께 쓰는 페이지 생성
+QWidget* InfoDisplayWidget::createEmployeePage()
 {
     QWidget* tab = new QWidget();
     QGridLayout* layout = new QGridLayout(tab);
 
-    EmployeeTabWidgets widgets;
-
+    EmployeeTabWidgets& widgets = m_employeeTab;
     widgets.hourlyWageLabel = new QLabel("시급: -");
     widgets.workHoursLabel = new QLabel("근무시간: -");
     widgets.basicPayLabel = new QLabel("근무시간 급여: -");
@@ -106,12 +142,31 @@ QWidget* InfoDisplayWidget::createEmployeeTab(int employeeId)
     layout->addWidget(widgets.totalPayLabel, 8, 0);
     layout->setRowStretch(9, 1);
 
-    // 저장
-    m_employeeTabWidgets[employeeId] = widgets;
-
     return tab;
 }
 
+int InfoDisplayWidget::tabIndexForEmployee(int employeeId) const
+{
+    return m_tabIndexById.value(employeeId, -1);
+}
+
+void InfoDisplayWidget::rebuildTabIndex(int fromIndex)
+{
+    if (fromIndex == 0) {
+        m_tabIndexById.clear();
+        m_tabIndexById.reserve(m_tabBar->count());
+    }
+    for (int i = fromIndex; i < m_tabBar->count(); ++i) {
+        const int employeeId = m_tabBar->tabData(i).toInt();
+        if (employeeId >= 0) m_tabIndexById.insert(employeeId, i);
+    }
+}
+
+bool InfoDisplayWidget::isEmployeeVisible(int employeeId) const
+{
+    return employeeId == m_currentEmployeeId || m_selectedEmployeeIds.contains(employeeId);
+}
+
 // 집계 탭 생성
 QWidget* InfoDisplayWidget::createAggregateTab()
 {
@@ -147,7 +202,19 @@ QWidget* InfoDisplayWidget::createAggregateTab()
 void InfoDisplayWidget::updateSelectedEmployees(const QList<int>& employeeIds)
 {
     m_selectedEmployeeIds = employeeIds;
-    updateAggregateTab();
+
+    // 계산이 진행 중이거나 급여표에 없는 직원이 선택된 경우에만 다시 계산
+    bool needsRecalculation = m_payrollCalculator->isRunning();
+    for (int employeeId : m_selectedEmployeeIds) {
+        if (needsRecalculation) break;
+        needsRecalculation = !m_payroll.contains(employeeId) && m_dataManager->findEmployee(employeeId);
+    }
+
+    if (needsRecalculation) {
+        recalculatePayroll();
+    } else {
+        updateAggregateTab();
+    }
 }
 
 // 기간 변경 시 호출
@@ -158,45 +225,171 @@ void InfoDisplayWidget::onPeriodChanged()
     updateAllTabs();
 }
 
-// 전체 탭 업데이트
-void InfoDisplayWidget::updateAllTabs()
+// 보이는 직원(현재 탭 + 선택된 직원)의 급여 계산을 요청 (진행 중인 이전 계산은 취소됨)
+// 나머지 직원의 이전 결과는 버려지고, 그 탭을 열 때 다시 계산됨
+void InfoDisplayWidget::recalculatePayroll()
+{
+    QList<int> employeeIds = m_selectedEmployeeIds;
+    if (m_currentEmployeeId >= 0 && !employeeIds.contains(m_currentEmployeeId)) {
+        employeeIds.append(m_currentEmployeeId);
+    }
+
+    showCalculatingState(employeeIds);
+    m_pendingPartial = false;
+    m_payrollCalculator->request(m_dataManager->snapshot(), m_startDate, m_endDate, employeeIds);
+}
+
+// 한 직원만 다시 계산 (전체 계산이 진행 중이면 그 계산은 이미 옛 데이터이므로 전체를 다시 요청)
+void InfoDisplayWidget::recalculateEmployee(int employeeId)
 {
-    for (auto it = m_employeeTabWidgets.begin(); it != m_employeeTabWidgets.end(); ++it) {
-        int employeeId = it.key();
-        updateEmployeeTab(employeeId);
+    if (m_payrollCalculator->isRunning()) {
+        recalculatePayroll();
+        return;
     }
 
+    const QList<int> employeeIds{employeeId};
+    showCalculatingState(employeeIds);
+    m_pendingPartial = true;
+    m_payrollCalculator->request(m_dataManager->snapshot(), m_startDate, m_endDate, employeeIds);
+}
+
+// 계산 결과가 올 때까지 해당 직원들의 금액 라벨을 "계산 중..."으로 바꿔 둠
+void InfoDisplayWidget::showCalculatingState(const QList<int>& employeeIds)
+{
+    const QString calculating = "계산 중...";
+    bool selectedAffected = false;
+    for (int employeeId : employeeIds) {
+        if (m_selectedEmployeeIds.contains(employeeId)) selectedAffected = true;
+
+        if (employeeId != m_currentEmployeeId) continue;
+        EmployeeTabWidgets& widgets = m_employeeTab;
+        widgets.workHoursLabel->setText("근무시간: " + calculating);
+        widgets.basicPayLabel->setText("근무시간 급여: " + calculating);
+        widgets.weeklyHolidayLabel->setText("+ 주휴수당: " + calculating);
+        widgets.taxLabel->setText("- 세금: " + calculating);
+        widgets.totalPayLabel->setText("= 총급여: " + calculating);
+    }
+
+    if (selectedAffected) {
+        m_aggBasicPayLabel->setText("근무시간 급여: " + calculating);
+        m_aggWeeklyHolidayLabel->setText("+ 주휴수당: " + calculating);
+        m_aggTaxLabel->setText("- 세금: " + calculating);
+        m_aggTotalPayLabel->setText("= 총급여: " + calculating);
+    }
+}
+
+// 작업 스레드에서 계산된 급여표를 받아 모든 탭에 표시
+void InfoDisplayWidget::onPayrollReady(const PayrollResult& result)
+{
+    if (m_pendingPartial) {
+        m_payroll.merge(result);
+    } else {
+        m_payroll = result;
+    }
+
+    updateEmployeeTab(m_currentEmployeeId);
     updateAggregateTab();
 }
 
+// 탭 전환: 페이지를 바꾸고, 이미 계산된 직원이면 바로 표시하고 아니면 그 직원만 계산
+void InfoDisplayWidget::onCurrentTabChanged(int index)
+{
+    m_currentEmployeeId = index >= 0 ? m_tabBar->tabData(index).toInt() : -1;
+    if (m_currentEmployeeId < 0) {
+        m_pageStack->setCurrentWidget(m_aggregatePage);
+        return;
+    }
+
+    m_pageStack->setCurrentWidget(m_employeePage);
+    if (m_payroll.contains(m_currentEmployeeId) && !m_payrollCalculator->isRunning()) {
+        updateEmployeeTab(m_currentEmployeeId);
+    } else {
+        recalculateEmployee(m_currentEmployeeId);
+    }
+}
+
+// 새 직원: 집계 탭 앞에 탭 항목만 추가 (계산은 그 탭을 열 때)
+void InfoDisplayWidget::onEmployeeAdded(int employeeId)
+{
+    const Employee* emp = m_dataManager->findEmployee(employeeId);
+    if (!emp || tabIndexForEmployee(employeeId) >= 0) return;
+
+    int index = m_tabBar->insertTab(qMax(0, m_tabBar->count() - 1), emp->getName());
+    m_tabBar->setTabData(index, employeeId);
+    m_tabIndexById.insert(employeeId, index); // 뒤에는 집계 탭뿐이므로 다른 직원의 위치는 그대로
+}
+
+// 직원 정보 변경: 탭 이름을 바꾸고, 보이는 직원이면 (시급이 바뀌었을 수 있으므로) 다시 계산
+void InfoDisplayWidget::onEmployeeUpdated(int employeeId)
+{
+    const Employee* emp = m_dataManager->findEmployee(employeeId);
+    int tabIndex = tabIndexForEmployee(employeeId);
+    if (!emp || tabIndex < 0) return;
+
+    m_tabBar->setTabText(tabIndex, emp->getName());
+    if (isEmployeeVisible(employeeId)) {
+        recalculateEmployee(employeeId);
+    } else {
+        m_payroll.removeLine(employeeId); // 탭을 열 때 다시 계산
+    }
+}
+
+// 직원 삭제: 탭 항목과 급여표의 해당 줄만 제거 (다른 직원은 다시 계산하지 않음)
+void InfoDisplayWidget::onEmployeeRemoved(int employeeId)
+{
+    m_payroll.removeLine(employeeId);
+    m_selectedEmployeeIds.removeAll(employeeId);
+
+    int tabIndex = tabIndexForEmployee(employeeId);
+    if (tabIndex >= 0) {
+        m_tabIndexById.remove(employeeId);
+        m_tabBar->removeTab(tabIndex); // 현재 탭이었다면 onCurrentTabChanged로 옆 탭이 표시됨
+        rebuildTabIndex(tabIndex); // 뒤쪽 탭들의 위치가 하나씩 당겨짐
+    }
+    updateAggregateTab();
+}
+
+// 근무 기록 변경: 바뀐 날짜가 조회 기간에 걸치고 보이는 직원일 때만 다시 계산
+void InfoDisplayWidget::onWorkLogsChanged(int employeeId, const QDate& fromDate, const QDate& toDate)
+{
+    if (toDate < m_startDate || fromDate > m_endDate) return;
+    if (isEmployeeVisible(employeeId)) {
+        recalculateEmployee(employeeId);
+    } else {
+        m_payroll.removeLine(employeeId); // 보이지 않는 직원은 결과만 버리고 탭을 열 때 계산
+    }
+}
+
+// 전체 탭 업데이트
+void InfoDisplayWidget::updateAllTabs()
+{
+    TRACE_SCOPE("InfoDisplayWidget::updateAllTabs");
+    recalculatePayroll();
+}
+
 // 특정 직원의 탭 업데이트
 void InfoDisplayWidget::updateEmployeeTab(int employeeId)
 {
-    if (!m_employeeTabWidgets.contains(employeeId)) return;
-
-    Employee emp = m_dataManager->getEmployeeById(employeeId);
-    if (emp.getId() == -1) return;
+    if (employeeId < 0 || employeeId != m_currentEmployeeId) return;
 
-    EmployeeTabWidgets& widgets = m_employeeTabWidgets[employeeId];
+    const PayrollLine* line = m_payroll.line(employeeId);
+    if (!line) return;
 
-    double totalHours = calculateTotalHours(employeeId, m_startDate, m_endDate);
-    double basicPay = totalHours * emp.getHourlyWage();
-    double weeklyHoliday = calculateWeeklyHolidayPay(employeeId, m_startDate, m_endDate);
-    double tax = (basicPay + weeklyHoliday) * 0.033;
-    double totalPay = basicPay + weeklyHoliday - tax;
+    EmployeeTabWidgets& widgets = m_employeeTab;
 
     QLocale locale(QLocale::Korean); // 원화 표시
-    widgets.hourlyWageLabel->setText("시급: " + locale.toString(emp.getHourlyWage()) + "원");
-    widgets.workHoursLabel->setText(QString("근무시간: %1시간").arg(totalHours, 0, 'f', 1));
-    widgets.basicPayLabel->setText("근무시간 급여: " + locale.toString((int)basicPay) + "원");
-    widgets.weeklyHolidayLabel->setText("+ 주휴수당: " + locale.toString((int)weeklyHoliday) + "원");
-    widgets.taxLabel->setText("- 세금: " + locale.toString((int)tax) + "원");
-    widgets.totalPayLabel->setText("= 총급여: " + locale.toString((int)totalPay) + "원");
+    widgets.hourlyWageLabel->setText("시급: " + locale.toString(line->hourlyWage) + "원");
+    widgets.workHoursLabel->setText(QString("근무시간: %1시간").arg(line->hours(), 0, 'f', 1));
+    widgets.basicPayLabel->setText("근무시간 급여: " + locale.toString(line->basicPay) + "원");
+    widgets.weeklyHolidayLabel->setText("+ 주휴수당: " + locale.toString(line->weeklyHolidayPay) + "원");
+    widgets.taxLabel->setText("- 세금: " + locale.toString(line->tax) + "원");
+    widgets.totalPayLabel->setText("= 총급여: " + locale.toString(line->netPay) + "원");
 }
 
 // 집계 탭 업데이트
 void InfoDisplayWidget::updateAggregateTab()
 {
+    TRACE_SCOPE("InfoDisplayWidget::updateAggregateTab");
     if (m_selectedEmployeeIds.isEmpty()) {
         m_selectedEmployeesLabel->setText("선택된 직원: 없음");
         m_aggBasicPayLabel->setText("근무시간 급여: 직원을 선택해주세요");
@@ -208,9 +401,8 @@ void InfoDisplayWidget::updateAggregateTab()
 
     QStringList employeeNames;
     for (int employeeId : m_selectedEmployeeIds) {
-        Employee emp = m_dataManager->getEmployeeById(employeeId);
-        if (emp.getId() != -1) {
-            employeeNames << emp.getName();
+        if (const PayrollLine* line = m_payroll.line(employeeId)) {
+            employeeNames << line->name;
         }
     }
 
@@ -224,80 +416,12 @@ void InfoDisplayWidget::updateAggregateTab()
     }
     m_selectedEmployeesLabel->setText(selectedText);
 
-    double totalBasicPay = 0, totalWeeklyHoliday = 0, totalTax = 0;
-
-    // 선택된 직원들에 대한 합계 계산
-    for (int employeeId : m_selectedEmployeeIds) {
-        Employee emp = m_dataManager->getEmployeeById(employeeId);
-        if (emp.getId() == -1) continue;
-
-        double hours = calculateTotalHours(employeeId, m_startDate, m_endDate);
-        double basicPay = hours * emp.getHourlyWage();
-
-        totalBasicPay += basicPay;
-        totalWeeklyHoliday += calculateWeeklyHolidayPay(employeeId, m_startDate, m_endDate);
-    }
-
-    totalTax = (totalBasicPay + totalWeeklyHoliday) * 0.033;
-    double totalPay = totalBasicPay + totalWeeklyHoliday - totalTax;
+    // 선택된 직원들에 대한 합계 (이미 계산된 급여표에서 합산)
+    const PayrollTotals totals = m_payroll.totalsFor(m_selectedEmployeeIds);
 
     QLocale locale(QLocale::Korean);
-    m_aggBasicPayLabel->setText("근무시간 급여: " + locale.toString((int)totalBasicPay) + "원");
-    m_aggWeeklyHolidayLabel->setText("+ 주휴수당: " + locale.toString((int)totalWeeklyHoliday) + "원");
-    m_aggTaxLabel->setText("- 세금: " + locale.toString((int)totalTax) + "원");
-    m_aggTotalPayLabel->setText("= 총급여: " + locale.toString((int)totalPay) + "원");
-}
-
-// 특정 직원의 전체 근무 시간 계산
-double InfoDisplayWidget::calculateTotalHours(int employeeId, const QDate& startDate, const QDate& endDate)
-{
-    double totalHours = 0.0;
-    const QList<WorkLog>& workLogs = m_dataManager->getWorkLogs();
-
-    for (const WorkLog& log : workLogs) {
-        if (log.getEmployeeId() == employeeId &&
-            log.getDate() >= startDate &&
-            log.getDate() <= endDate) {
-            totalHours += log.getHoursWorked();
-        }
-    }
-
-    return totalHours;
-}
-
-// 주별 근무시간을 QMap 형태로 계산 (월요일 시작 기준)
-QMap<QDate, double> InfoDisplayWidget::calculateWeeklyHours(int employeeId, const QDate& startDate, const QDate& endDate)
-{
-    QMap<QDate, double> weeklyHours;
-    QDate currentDate = startDate;
-
-    while (currentDate <= endDate) {
-        WorkLog log = m_dataManager->getWorkLogByEmployeeAndDate(employeeId, currentDate);
-        if (log.getEmployeeId() != -1) {
-            QDate weekStart = currentDate.addDays(1 - currentDate.dayOfWeek()); // 월요일 기준
-            weeklyHours[weekStart] += log.getHoursWorked();
-        }
-        currentDate = currentDate.addDays(1);
-    }
-
-    return weeklyHours;
-}
-
-// 주휴수당 계산: 주당 15시간 이상 근무 시, 시급 * 0.2 * 그 주의 시간
-double InfoDisplayWidget::calculateWeeklyHolidayPay(int employeeId, const QDate& startDate, const QDate& endDate)
-{
-    Employee emp = m_dataManager->getEmployeeById(employeeId);
-    if (emp.getId() == -1) return 0.0;
-
-    QMap<QDate, double> weeklyHours = calculateWeeklyHours(employeeId, startDate, endDate);
-    double totalWeeklyHoliday = 0.0;
-
-    for (auto it = weeklyHours.begin(); it != weeklyHours.end(); ++it) {
-        double weekHours = it.value();
-        if (weekHours >= 15.0) {
-            totalWeeklyHoliday += emp.getHourlyWage() * 0.2 * weekHours;
-        }
-    }
-
-    return totalWeeklyHoliday;
+    m_aggBasicPayLabel->setText("근무시간 급여: " + locale.toString(totals.basicPay) + "원");
+    m_aggWeeklyHolidayLabel->setText("+ 주휴수당: " + locale.toString(totals.weeklyHolidayPay) + "원");
+    m_aggTaxLabel->setText("- 세금: " + locale.toString(totals.tax) + "원");
+    m_aggTotalPayLabel->setText("= 총급여: " + locale.toString(totals.netPay) + "원");
 }
@@ -2,7 +2,8 @@
 #define INFODISPLAYWIDGET_H
 
 #include <QWidget>
-#include <QTabWidget>
+#include <QTabBar>
+#include <QStackedWidget>
 #include <QLabel>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
@@ -11,11 +12,13 @@
 #include <QPushButton>
 #include <QGroupBox>
 #include <QFrame>
+#include <QHash>
 #include "datamanager.h"
+#include "payrollengine.h"
+#include "payrollcalculator.h"
 
 // 직원별 급여 정보 탭에 들어가는 UI 라벨들을 묶어놓은 구조체
 struct EmployeeTabWidgets {
-    QLabel* nameLabel;
     QLabel* hourlyWageLabel;
     QLabel* workHoursLabel;
     QLabel* basicPayLabel;
@@ -25,13 +28,15 @@ struct EmployeeTabWidgets {
 };
 
 // 급여 정보를 계산해서 탭 형태로 보여주는 위젯 클래스
+// 직원 탭은 탭 바의 항목일 뿐이고, 라벨이 있는 직원 페이지는 하나만 만들어 현재 탭의 직원으로 채움
+// 급여 계산도 화면에 보이는 직원(현재 탭 + 집계 탭의 선택 직원)만 대상으로 함
 class InfoDisplayWidget : public QWidget
 {
     Q_OBJECT
 
 public:
     explicit InfoDisplayWidget(DataManager* dataManager, QWidget *parent = nullptr);
-    // 모든 탭의 내용을 최신 정보로 업데이트
+    // 보이는 탭의 내용을 최신 정보로 업데이트 (급여 계산은 작업 스레드에서 진행되고 끝나면 표시됨)
     void updateAllTabs();
     // 직원 목록 변경 시 탭 자체를 새로 구성
     void refreshEmployeeTabs();
@@ -43,20 +48,37 @@ public slots:
 private slots:
     // 사용자가 '갱신' 버튼을 눌러 기간을 변경했을 때 호출됨
     void onPeriodChanged();
+    // 작업 스레드의 급여 계산이 끝났을 때 호출됨
+    void onPayrollReady(const PayrollResult& result);
+    // 탭을 바꿨을 때: 해당 페이지를 보여주고, 아직 계산되지 않은 직원이면 그때 계산
+    void onCurrentTabChanged(int index);
+    // DataManager 변경 알림: 바뀐 직원의 탭과 급여만 다시 계산
+    void onEmployeeAdded(int employeeId);
+    void onEmployeeUpdated(int employeeId);
+    void onEmployeeRemoved(int employeeId);
+    void onWorkLogsChanged(int employeeId, const QDate& fromDate, const QDate& toDate);
 
 private:
     // private 헬퍼 함수들
     void setupUI(); // 위젯의 초기 UI를 설정
-    void updateEmployeeTab(int employeeId); // 특정 직원 탭의 정보를 업데이트
+    void updateEmployeeTab(int employeeId); // 특정 직원 탭의 정보를 업데이트 (현재 보이는 직원일 때만)
     void updateAggregateTab(); // 집계 탭의 정보를 업데이트
-    QWidget* createEmployeeTab(int employeeId); // 직원 탭 위젯 생성
+    QWidget* createEmployeePage(); // 모든 직원 탭이 함께 쓰는 페이지 생성
     QWidget* createAggregateTab(); // 집계 탭 위젯 생성
-    double calculateTotalHours(int employeeId, const QDate& startDate, const QDate& endDate); // 총 근무시간 계산
-    double calculateWeeklyHolidayPay(int employeeId, const QDate& startDate, const QDate& endDate); // 주휴수당 계산
+    int tabIndexForEmployee(int employeeId) const; // 직원 탭 위치 (없으면 -1), O(1)
+    void rebuildTabIndex(int fromIndex = 0); // fromIndex 이후 탭들의 직원 ID → 탭 위치 색인 재구성
+    bool isEmployeeVisible(int employeeId) const; // 현재 탭이거나 집계 탭에 선택된 직원인지
+    void recalculatePayroll(); // 보이는 직원 전체의 급여 계산을 요청
+    void recalculateEmployee(int employeeId); // 한 직원만 다시 계산해서 기존 급여표에 합침
+    void showCalculatingState(const QList<int>& employeeIds); // 계산이 끝날 때까지 금액 라벨에 "계산 중..." 표시
 
     // 멤버 변수
     DataManager* m_dataManager; // 데이터 관리자 포인터
-    QTabWidget* m_tabWidget;    // 탭들을 담는 위젯
+    QTabBar* m_tabBar;          // 직원 탭들과 마지막의 집계 탭 (탭 데이터 = 직원 ID, 집계 탭은 -1)
+    QHash<int, int> m_tabIndexById; // 직원 ID → 탭 위치 (집계 탭은 없음)
+    QStackedWidget* m_pageStack; // 직원 페이지 / 집계 페이지 중 하나를 보여줌
+    QWidget* m_employeePage;
+    QWidget* m_aggregatePage;
 
     // 기간 설정 UI 요소
     QDateEdit* m_startDateEdit;
@@ -70,15 +92,19 @@ private:
     QLabel* m_aggTaxLabel;
     QLabel* m_aggTotalPayLabel;
 
-    // 직원 ID와 해당 직원의 탭 위젯들을 매핑하여 관리
-    QMap<int, EmployeeTabWidgets> m_employeeTabWidgets;
+    // 직원 페이지의 라벨들과 지금 그 페이지에 표시 중인 직원 (-1이면 집계 탭)
+    EmployeeTabWidgets m_employeeTab;
+    int m_currentEmployeeId;
 
     // 현재 선택된 직원 ID 목록과 날짜 기간
     QList<int> m_selectedEmployeeIds;
     QDate m_startDate;
     QDate m_endDate;
 
-    QMap<QDate, double> calculateWeeklyHours(int employeeId, const QDate& startDate, const QDate& endDate);
+    // 비동기 급여 계산기와 마지막 계산 결과 (탭들은 이 결과를 표시만 함)
+    PayrollCalculator* m_payrollCalculator;
+    PayrollResult m_payroll;
+    bool m_pendingPartial; // 진행 중인 계산이 일부 직원만 대상으로 하는지 (결과를 합칠지 교체할지)
 };
 
 #endif // INFODISPLAYWIDGET_H
@@ -0,0 +1,500 @@
+#include "jsonstreamreader.h"
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <cstring>
+
+JsonStreamReader::JsonStreamReader(QIODevice *device, int chunkSize)
+    : m_device(device)
+    , m_chunkSize(chunkSize > 0 ? chunkSize : DefaultChunkSize)
+    , m_base(0)
+    , m_pos(0)
+    , m_tokenType(NoToken)
+    , m_expect(ExpectValue)
+    , m_boolValue(false)
+    , m_arrayFragment(false)
+{
+}
+
+JsonStreamReader::JsonStreamReader(const char *data, qint64 size)
+    : m_device(nullptr)
+    , m_chunkSize(0)
+    , m_buffer(QByteArray::fromRawData(data, qsizetype(size)))
+    , m_base(0)
+    , m_pos(0)
+    , m_tokenType(NoToken)
+    , m_expect(ExpectValue)
+    , m_boolValue(false)
+    , m_arrayFragment(false)
+{
+}
+
+// 현재 청크를 다 읽었을 때만 다음 청크를 읽어 옴 (이전 청크는 버림)
+bool JsonStreamReader::fill()
+{
+    if (m_pos < m_buffer.size()) return true;
+    if (!m_device) return false;
+
+    m_base += m_buffer.size();
+    m_pos = 0;
+    m_buffer = m_device->read(m_chunkSize);
+    return !m_buffer.isEmpty();
+}
+
+bool JsonStreamReader::skipWhitespace(char *next)
+{
+    for (;;) {
+        if (!fill()) return false;
+        const char *data = m_buffer.constData();
+        const qsizetype size = m_buffer.size();
+        while (m_pos < size) {
+            char c = data[m_pos];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                *next = c;
+                return true;
+            }
+            ++m_pos;
+        }
+    }
+}
+
+JsonStreamReader::TokenType JsonStreamReader::fail(const QString &message)
+{
+    if (m_tokenType != Error) {
+        m_errorString = QString("%1 (offset %2)").arg(message).arg(offset());
+    }
+    m_tokenType = Error;
+    return Error;
+}
+
+void JsonStreamReader::afterValue()
+{
+    m_expect = m_stack.isEmpty() ? ExpectDocumentEnd : ExpectCommaOrEnd;
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readNext()
+{
+    if (m_tokenType == Error || m_tokenType == EndOfDocument) return m_tokenType;
+
+    for (;;) {
+        char c = 0;
+        if (!skipWhitespace(&c)) {
+            if (m_expect == ExpectDocumentEnd) {
+                m_tokenType = EndOfDocument;
+                return m_tokenType;
+            }
+            if (m_arrayFragment && m_stack.size() == 1
+                && (m_expect == ExpectCommaOrEnd || m_expect == ExpectValueOrEnd)) {
+                // 조각의 끝 = 암묵적인 배열 끝
+                m_stack.removeLast();
+                m_expect = ExpectDocumentEnd;
+                m_tokenType = EndArray;
+                return m_tokenType;
+            }
+            return fail("Unexpected end of JSON data");
+        }
+
+        switch (m_expect) {
+        case ExpectDocumentEnd:
+            return fail("Garbage after JSON document");
+
+        case ExpectColon:
+            if (c != ':') return fail("Expected ':'");
+            ++m_pos;
+            m_expect = ExpectValue;
+            continue;
+
+        case ExpectCommaOrEnd:
+            if (c == ',') {
+                ++m_pos;
+                m_expect = (m_stack.last() == '{') ? ExpectName : ExpectValue;
+                continue;
+            }
+            if ((c == '}' && m_stack.last() == '{') || (c == ']' && m_stack.last() == '[')) {
+                ++m_pos;
+                m_stack.removeLast();
+                afterValue();
+                m_tokenType = (c == '}') ? EndObject : EndArray;
+                return m_tokenType;
+            }
+            return fail("Expected ',' or end of container");
+
+        case ExpectNameOrEnd:
+            if (c == '}') {
+                ++m_pos;
+                m_stack.removeLast();
+                afterValue();
+                m_tokenType = EndObject;
+                return m_tokenType;
+            }
+            Q_FALLTHROUGH();
+        case ExpectName:
+            if (c != '"') return fail("Expected object key");
+            ++m_pos;
+            if (!readString()) return fail("Unterminated or invalid string");
+            m_expect = ExpectColon;
+            m_tokenType = Name;
+            return m_tokenType;
+
+        case ExpectValueOrEnd:
+            if (c == ']') {
+                ++m_pos;
+                m_stack.removeLast();
+                afterValue();
+                m_tokenType = EndArray;
+                return m_tokenType;
+            }
+            Q_FALLTHROUGH();
+        case ExpectValue:
+            return readValueToken(c);
+        }
+    }
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readValueToken(char first)
+{
+    switch (first) {
+    case '{':
+        ++m_pos;
+        m_stack.append('{');
+        m_expect = ExpectNameOrEnd;
+        m_tokenType = BeginObject;
+        return m_tokenType;
+    case '[':
+        ++m_pos;
+        m_stack.append('[');
+        m_expect = ExpectValueOrEnd;
+        m_tokenType = BeginArray;
+        return m_tokenType;
+    case '"':
+        ++m_pos;
+        if (!readString()) return fail("Unterminated or invalid string");
+        m_tokenType = String;
+        break;
+    case 't':
+        if (!readLiteral("true", 4)) return fail("Invalid literal");
+        m_boolValue = true;
+        m_tokenType = Bool;
+        break;
+    case 'f':
+        if (!readLiteral("false", 5)) return fail("Invalid literal");
+        m_boolValue = false;
+        m_tokenType = Bool;
+        break;
+    case 'n':
+        if (!readLiteral("null", 4)) return fail("Invalid literal");
+        m_tokenType = Null;
+        break;
+    default:
+        if (first != '-' && (first < '0' || first > '9')) return fail("Unexpected character");
+        if (!readNumber()) return fail("Invalid number");
+        m_tokenType = Number;
+        break;
+    }
+    afterValue();
+    return m_tokenType;
+}
+
+// 여는 따옴표 다음부터 닫는 따옴표까지 읽어서 m_value에 UTF-8로 저장
+bool JsonStreamReader::readString()
+{
+    m_value.clear();
+    for (;;) {
+        if (!fill()) return false;
+        const char *data = m_buffer.constData();
+        const qsizetype size = m_buffer.size();
+
+        // 따옴표나 역슬래시가 나올 때까지의 구간을 한 번에 복사
+        qsizetype start = m_pos;
+        while (m_pos < size) {
+            char c = data[m_pos];
+            if (c == '"' || c == '\\') break;
+            if (static_cast<unsigned char>(c) < 0x20) return false; // 이스케이프 안 된 제어 문자
+            ++m_pos;
+        }
+        m_value.append(data + start, m_pos - start);
+        if (m_pos == size) continue; // 청크 경계 - 다음 청크에서 계속
+
+        if (data[m_pos] == '"') {
+            ++m_pos;
+            return true;
+        }
+        ++m_pos; // 역슬래시
+        if (!appendEscape()) return false;
+    }
+}
+
+namespace {
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void appendUtf8(QByteArray &out, uint codePoint)
+{
+    if (codePoint < 0x80) {
+        out.append(char(codePoint));
+    } else if (codePoint < 0x800) {
+        out.append(char(0xC0 | (codePoint >> 6)));
+        out.append(char(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out.append(char(0xE0 | (codePoint >> 12)));
+        out.append(char(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.append(char(0x80 | (codePoint & 0x3F)));
+    } else {
+        out.append(char(0xF0 | (codePoint >> 18)));
+        out.append(char(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.append(char(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.append(char(0x80 | (codePoint & 0x3F)));
+    }
+}
+}
+
+// 역슬래시 다음의 이스케이프 문자를 풀어서 m_value에 추가
+bool JsonStreamReader::appendEscape()
+{
+    auto nextChar = [this](char *c) {
+        if (!fill()) return false;
+        *c = m_buffer.constData()[m_pos++];
+        return true;
+    };
+    auto readHex4 = [&nextChar](uint *value) {
+        *value = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = 0;
+            if (!nextChar(&c)) return false;
+            int digit = hexValue(c);
+            if (digit < 0) return false;
+            *value = (*value << 4) | uint(digit);
+        }
+        return true;
+    };
+
+    char escape = 0;
+    if (!nextChar(&escape)) return false;
+    switch (escape) {
+    case '"': m_value.append('"'); return true;
+    case '\\': m_value.append('\\'); return true;
+    case '/': m_value.append('/'); return true;
+    case 'b': m_value.append('\b'); return true;
+    case 'f': m_value.append('\f'); return true;
+    case 'n': m_value.append('\n'); return true;
+    case 'r': m_value.append('\r'); return true;
+    case 't': m_value.append('\t'); return true;
+    case 'u': {
+        uint codePoint = 0;
+        if (!readHex4(&codePoint)) return false;
+        if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+            // 상위 서로게이트 - 바로 뒤에 \uDC00~\uDFFF가 와야 함
+            char backslash = 0, u = 0;
+            uint low = 0;
+            if (!nextChar(&backslash) || !nextChar(&u) || backslash != '\\' || u != 'u' || !readHex4(&low)
+                || low < 0xDC00 || low > 0xDFFF) {
+                return false;
+            }
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+            return false;
+        }
+        appendUtf8(m_value, codePoint);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+bool JsonStreamReader::readNumber()
+{
+    m_value.clear();
+    for (;;) {
+        if (!fill()) break; // 문서 끝에서 끝나는 숫자
+        const char *data = m_buffer.constData();
+        const qsizetype size = m_buffer.size();
+        qsizetype start = m_pos;
+        while (m_pos < size) {
+            char c = data[m_pos];
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+                ++m_pos;
+            } else {
+                break;
+            }
+        }
+        m_value.append(data + start, m_pos - start);
+        if (m_pos < size) break;
+    }
+
+    // JSON 숫자 문법 확인: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    const char *p = m_value.constData();
+    const char *end = p + m_value.size();
+    if (p < end && *p == '-') ++p;
+    if (p == end) return false;
+    if (*p == '0') {
+        ++p;
+    } else if (*p >= '1' && *p <= '9') {
+        while (p < end && *p >= '0' && *p <= '9') ++p;
+    } else {
+        return false;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        const char *digits = p;
+        while (p < end && *p >= '0' && *p <= '9') ++p;
+        if (p == digits) return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        if (p < end && (*p == '+' || *p == '-')) ++p;
+        const char *digits = p;
+        while (p < end && *p >= '0' && *p <= '9') ++p;
+        if (p == digits) return false;
+    }
+    return p == end;
+}
+
+bool JsonStreamReader::readLiteral(const char *literal, int length)
+{
+    for (int i = 0; i < length; ++i) {
+        if (!fill() || m_buffer.constData()[m_pos] != literal[i]) return false;
+        ++m_pos;
+    }
+    return true;
+}
+
+QJsonValue JsonStreamReader::numberValue() const
+{
+    // QJsonDocument처럼 소수점/지수가 없고 qint64 범위면 정수로 보관
+    bool isInteger = std::strpbrk(m_value.constData(), ".eE") == nullptr;
+    if (isInteger) {
+        bool ok = false;
+        qint64 integer = m_value.toLongLong(&ok);
+        if (ok) return QJsonValue(integer);
+    }
+    return QJsonValue(m_value.toDouble());
+}
+
+void JsonStreamReader::beginArrayFragment()
+{
+    m_stack.clear();
+    m_stack.append('[');
+    m_expect = ExpectValueOrEnd;
+    m_tokenType = BeginArray;
+    m_arrayFragment = true;
+}
+
+bool JsonStreamReader::skipArrayRecordingSplits(int every, QList<qint64> *splitOffsets)
+{
+    if (m_device || m_tokenType != BeginArray || every <= 0) return false;
+
+    const char *data = m_buffer.constData();
+    const qsizetype size = m_buffer.size();
+    int depth = 0;
+    int elementCount = 0;
+    bool inString = false;
+
+    for (qsizetype pos = m_pos; pos < size; ++pos) {
+        const char c = data[pos];
+        if (inString) {
+            if (c == '\\') {
+                ++pos; // 이스케이프된 문자는 건너뜀
+            } else if (c == '"') {
+                inString = false;
+            }
+            continue;
+        }
+        switch (c) {
+        case '"':
+            inString = true;
+            break;
+        case '{':
+        case '[':
+            ++depth;
+            break;
+        case '}':
+            --depth;
+            break;
+        case ']':
+            if (depth == 0) {
+                // 배열 끝: 일반 readNext()로 ']'를 읽은 것과 같은 상태로 맞춤
+                m_pos = pos + 1;
+                m_stack.removeLast();
+                afterValue();
+                m_tokenType = EndArray;
+                return true;
+            }
+            --depth;
+            break;
+        case ',':
+            if (depth == 0 && ++elementCount % every == 0) {
+                splitOffsets->append(m_base + pos);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    fail("Unterminated array");
+    return false;
+}
+
+bool JsonStreamReader::skipCurrentValue()
+{
+    if (m_tokenType != BeginObject && m_tokenType != BeginArray) {
+        return m_tokenType != Error && m_tokenType != EndOfDocument;
+    }
+    const int depth = m_stack.size();
+    while (m_stack.size() >= depth) {
+        if (readNext() == Error) return false;
+    }
+    return true;
+}
+
+bool JsonStreamReader::skipNextValue()
+{
+    TokenType token = readNext();
+    if (token == Error || token == EndOfDocument || token == EndObject || token == EndArray) return false;
+    return skipCurrentValue();
+}
+
+bool JsonStreamReader::readNextValue(QJsonValue *value)
+{
+    readNext();
+    return readCurrentValue(value);
+}
+
+bool JsonStreamReader::readCurrentValue(QJsonValue *value)
+{
+    switch (m_tokenType) {
+    case String: *value = QJsonValue(stringValue()); return true;
+    case Number: *value = numberValue(); return true;
+    case Bool: *value = QJsonValue(m_boolValue); return true;
+    case Null: *value = QJsonValue(QJsonValue::Null); return true;
+    case BeginObject: {
+        QJsonObject object;
+        while (readNext() == Name) {
+            QString key = stringValue();
+            QJsonValue member;
+            if (!readNextValue(&member)) return false;
+            object.insert(key, member);
+        }
+        if (m_tokenType != EndObject) return false;
+        *value = object;
+        return true;
+    }
+    case BeginArray: {
+        QJsonArray array;
+        while (readNext() != EndArray) {
+            QJsonValue element;
+            if (!readCurrentValue(&element)) return false;
+            array.append(element);
+        }
+        *value = array;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef JSONSTREAMREADER_H
+#define JSONSTREAMREADER_H
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QList>
+#include <QString>
+#include <QVarLengthArray>
+
+class QIODevice;
+
+// JSON 문서를 DOM(QJsonDocument)으로 만들지 않고 토큰 단위로 읽는 스트리밍(SAX 방식) 리더
+// - QIODevice에서 고정 크기 청크로 조금씩 읽어 오므로 파일 전체를 메모리에 올리지 않음
+// - 이미 메모리에 있는 바이트 범위(메모리 매핑된 파일 등)를 직접 읽을 수도 있음
+//
+// 사용 예:
+//   JsonStreamReader reader(&file);
+//   if (reader.readNext() == JsonStreamReader::BeginObject) {
+//       while (reader.readNext() == JsonStreamReader::Name) { ... }
+//   }
+class JsonStreamReader
+{
+public:
+    enum TokenType {
+        NoToken,
+        BeginObject,
+        EndObject,
+        BeginArray,
+        EndArray,
+        Name,    // 객체의 키 (stringValue()로 확인)
+        String,
+        Number,
+        Bool,
+        Null,
+        EndOfDocument,
+        Error
+    };
+
+    static const int DefaultChunkSize = 64 * 1024;
+
+    // device에서 chunkSize 바이트씩 읽음
+    explicit JsonStreamReader(QIODevice *device, int chunkSize = DefaultChunkSize);
+    // [data, data + size) 범위를 복사 없이 읽음 (범위는 리더보다 오래 살아 있어야 함)
+    JsonStreamReader(const char *data, qint64 size);
+
+    // 다음 토큰을 읽어 종류를 반환 (형식 오류면 Error)
+    TokenType readNext();
+    TokenType tokenType() const { return m_tokenType; }
+
+    // Name/String: 이스케이프를 푼 UTF-8 바이트, Number: 숫자 원문
+    const QByteArray &rawValue() const { return m_value; }
+    QString stringValue() const { return QString::fromUtf8(m_value); }
+    // QJsonDocument와 같은 규칙의 숫자 값 (정수로 표현되면 정수, 아니면 double)
+    QJsonValue numberValue() const;
+    bool boolValue() const { return m_boolValue; }
+
+    // 방금 읽은 토큰이 BeginObject/BeginArray면 짝이 맞는 끝까지 건너뜀 (그 외 값은 그대로 둠)
+    bool skipCurrentValue();
+    // 다음 값을 읽어 건너뜀
+    bool skipNextValue();
+    // 다음 값을 읽어 QJsonValue로 만듦 (작은 하위 객체용)
+    bool readNextValue(QJsonValue *value);
+    // 방금 읽은 토큰에서 시작하는 값을 QJsonValue로 만듦 (객체/배열이면 끝까지 읽음)
+    bool readCurrentValue(QJsonValue *value);
+
+    // --- 메모리 범위 모드 전용 (병렬 파싱용) ---
+    // 배열 원소 일부만 담긴 범위를 읽을 때 호출: '[' 안에서 시작한 것처럼 동작하고 범위 끝을 배열 끝(EndArray)으로 처리
+    void beginArrayFragment();
+    // 방금 읽은 BeginArray의 내용을 토큰화하지 않고 구조(따옴표/괄호)만 훑어 배열 끝 다음으로 이동
+    // 최상위 원소 사이의 ',' 위치를 every개 원소마다 splitOffsets에 기록 (원소 단위로 안전하게 나눌 수 있는 지점)
+    bool skipArrayRecordingSplits(int every, QList<qint64> *splitOffsets);
+
+    // 다음에 읽을 바이트의 절대 위치 (청크를 넘어가도 누적)
+    qint64 offset() const { return m_base + m_pos; }
+    bool hasError() const { return m_tokenType == Error; }
+    QString errorString() const { return m_errorString; }
+
+private:
+    enum Expect {
+        ExpectValue,
+        ExpectValueOrEnd,  // '[' 직후
+        ExpectNameOrEnd,   // '{' 직후
+        ExpectName,        // 객체 안의 ',' 직후
+        ExpectColon,
+        ExpectCommaOrEnd,
+        ExpectDocumentEnd
+    };
+
+    bool fill(); // 버퍼를 다 읽었으면 다음 청크를 가져옴
+    bool skipWhitespace(char *next); // 공백을 건너뛰고 다음 문자를 (소비하지 않고) 반환
+    TokenType readValueToken(char first);
+    bool readString();
+    bool readNumber();
+    bool readLiteral(const char *literal, int length);
+    bool appendEscape();
+    void afterValue();
+    TokenType fail(const QString &message);
+
+    QIODevice *m_device;       // 청크를 읽어 올 장치 (메모리 범위 모드면 nullptr)
+    int m_chunkSize;
+    QByteArray m_buffer;       // 장치 모드: 현재 청크 / 메모리 모드: 원본을 감싼 raw 데이터
+    qint64 m_base;             // m_buffer 첫 바이트의 절대 위치
+    qsizetype m_pos;           // m_buffer 안에서 다음에 읽을 위치
+
+    TokenType m_tokenType;
+    Expect m_expect;
+    QVarLengthArray<char, 32> m_stack; // 열린 컨테이너 ('{' 또는 '[')
+    QByteArray m_value;
+    bool m_boolValue;
+    QString m_errorString;
+    bool m_arrayFragment;      // beginArrayFragment()로 시작한 경우 범위 끝 = 배열 끝
+};
+
+#endif // JSONSTREAMREADER_H
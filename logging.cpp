@@ -0,0 +1,163 @@
+#include "logging.h"
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QVector>
+#include <cstdio>
+#include <utility>
+
+Q_LOGGING_CATEGORY(lcData, "cpp_project.data", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcJournal, "cpp_project.journal", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcSnapshot, "cpp_project.snapshot", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcTrace, "cpp_project.trace", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcImport, "cpp_project.import", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcCalendar, "cpp_project.ui.calendar", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcEmployeePanel, "cpp_project.ui.employees", QtInfoMsg)
+Q_LOGGING_CATEGORY(lcMainWindow, "cpp_project.ui.main", QtInfoMsg)
+
+namespace Logging {
+
+namespace {
+const char kCategoryPrefix[] = "cpp_project.";
+const int kCategoryPrefixLength = sizeof(kCategoryPrefix) - 1;
+
+struct Entry {
+    qint64 elapsedMs;
+    QtMsgType type;
+    QByteArray category;
+    QString message;
+};
+
+// 링 버퍼와 "디버그 단계도 출력하는 카테고리" 목록은 여러 스레드의 로그가 함께 쓰므로 잠금으로 보호
+QMutex s_mutex;
+QVector<Entry> s_entries;
+int s_next = 0;
+int s_count = 0;
+QSet<QByteArray> s_printDebugCategories;
+QElapsedTimer s_clock;
+bool s_installed = false;
+QtMessageHandler s_previousHandler = nullptr;
+QLoggingCategory::CategoryFilter s_previousFilter = nullptr;
+
+bool isOwnCategory(const char *name)
+{
+    return name && qstrncmp(name, kCategoryPrefix, kCategoryPrefixLength) == 0;
+}
+
+char typeLetter(QtMsgType type)
+{
+    switch (type) {
+    case QtDebugMsg: return 'D';
+    case QtInfoMsg: return 'I';
+    case QtWarningMsg: return 'W';
+    case QtCriticalMsg: return 'C';
+    case QtFatalMsg: return 'F';
+    }
+    return '?';
+}
+
+// 원래 규칙(QT_LOGGING_RULES 등)으로 디버그가 켜져 있었는지 기억해 두고, 보관을 위해 디버그 단계를 항상 켬
+void ringCategoryFilter(QLoggingCategory *category)
+{
+    if (s_previousFilter) s_previousFilter(category);
+    if (!isOwnCategory(category->categoryName())) return;
+
+    const QByteArray name(category->categoryName());
+    {
+        QMutexLocker locker(&s_mutex);
+        if (category->isDebugEnabled()) {
+            s_printDebugCategories.insert(name);
+        } else {
+            s_printDebugCategories.remove(name);
+        }
+    }
+    category->setEnabled(QtDebugMsg, true);
+}
+
+void forward(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    if (s_previousHandler) {
+        s_previousHandler(type, context, message);
+        return;
+    }
+    const QString formatted = qFormatLogMessage(type, context, message);
+    std::fprintf(stderr, "%s\n", formatted.toLocal8Bit().constData());
+    std::fflush(stderr);
+}
+
+void ringMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    // 심각한 오류면 그 직전까지의 기록을 먼저 쏟아냄
+    if (type == QtCriticalMsg || type == QtFatalMsg) {
+        dumpRingBuffer();
+    }
+
+    bool print = true;
+    {
+        QMutexLocker locker(&s_mutex);
+        if (type == QtDebugMsg && isOwnCategory(context.category)) {
+            print = s_printDebugCategories.contains(QByteArray::fromRawData(context.category, int(qstrlen(context.category))));
+        }
+        Entry &entry = s_entries[s_next];
+        entry.elapsedMs = s_clock.elapsed();
+        entry.type = type;
+        entry.category = context.category ? QByteArray(context.category) : QByteArray("default");
+        entry.message = message;
+        s_next = (s_next + 1) % s_entries.size();
+        s_count = qMin(s_count + 1, int(s_entries.size()));
+    }
+
+    if (print) forward(type, context, message);
+}
+}
+
+bool initialize()
+{
+    const int capacity = qEnvironmentVariableIntValue("CPP_PROJECT_LOG_RING");
+    if (capacity <= 0) return false;
+    installRingBuffer(capacity);
+    return true;
+}
+
+void installRingBuffer(int capacity)
+{
+    if (capacity <= 0) return;
+    {
+        QMutexLocker locker(&s_mutex);
+        if (s_installed) return;
+        s_installed = true;
+        s_entries.resize(capacity);
+        s_next = 0;
+        s_count = 0;
+        s_clock.start();
+    }
+    s_previousHandler = qInstallMessageHandler(ringMessageHandler);
+    s_previousFilter = QLoggingCategory::installFilter(ringCategoryFilter);
+}
+
+void dumpRingBuffer()
+{
+    QVector<Entry> entries;
+    {
+        QMutexLocker locker(&s_mutex);
+        if (s_count == 0) return;
+        entries.reserve(s_count);
+        const int size = s_entries.size();
+        for (int i = 0; i < s_count; ++i) {
+            entries.append(s_entries.at((s_next - s_count + i + size) % size));
+        }
+        s_count = 0;
+    }
+
+    std::fprintf(stderr, "--- last %d log message(s) ---\n", int(entries.size()));
+    for (const Entry &entry : std::as_const(entries)) {
+        std::fprintf(stderr, "[%8lld ms] %c %s: %s\n", static_cast<long long>(entry.elapsedMs),
+                     typeLetter(entry.type), entry.category.constData(), entry.message.toLocal8Bit().constData());
+    }
+    std::fprintf(stderr, "--- end of log messages ---\n");
+    std::fflush(stderr);
+}
+
+} // namespace Logging
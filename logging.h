@@ -0,0 +1,39 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <QLoggingCategory>
+
+// 분야별 로그 카테고리
+// 디버그 단계는 기본으로 꺼져 있고(정보 단계부터 출력), 필요한 분야만 QT_LOGGING_RULES로 켬
+//   예) QT_LOGGING_RULES="cpp_project.data.debug=true;cpp_project.ui.*.debug=true"
+// qCDebug 등은 카테고리가 꺼져 있으면 << 뒤의 인자를 계산하지 않으므로 날짜 문자열 같은 포맷 비용이 들지 않음
+Q_DECLARE_LOGGING_CATEGORY(lcData)          // cpp_project.data: 직원/근무 기록 변경, 불러오기/저장
+Q_DECLARE_LOGGING_CATEGORY(lcJournal)       // cpp_project.journal: 변경 저널
+Q_DECLARE_LOGGING_CATEGORY(lcSnapshot)      // cpp_project.snapshot: 바이너리 스냅샷
+Q_DECLARE_LOGGING_CATEGORY(lcTrace)         // cpp_project.trace: 성능 추적 내보내기
+Q_DECLARE_LOGGING_CATEGORY(lcImport)        // cpp_project.import: 출퇴근 기록 가져오기
+Q_DECLARE_LOGGING_CATEGORY(lcCalendar)      // cpp_project.ui.calendar: 달력 위젯
+Q_DECLARE_LOGGING_CATEGORY(lcEmployeePanel) // cpp_project.ui.employees: 직원 목록 패널
+Q_DECLARE_LOGGING_CATEGORY(lcMainWindow)    // cpp_project.ui.main: 메인 창
+
+// 근무 기록 한 건마다, 다시 그릴 때마다 불리는 경로의 디버그 로그
+// 릴리스 빌드(QT_NO_DEBUG)에서는 카테고리 확인까지 통째로 빠지고, 디버그 빌드에서는 qCDebug와 같음
+#if defined(QT_NO_DEBUG) || defined(QT_NO_DEBUG_OUTPUT)
+#define LOG_HOT(category) while (false) QMessageLogger().noDebug()
+#else
+#define LOG_HOT(category) qCDebug(category)
+#endif
+
+namespace Logging {
+
+// 최근 로그를 메모리에 돌려 쓰며 보관하다가 심각한 오류(qCritical/qFatal)가 나면 표준 오류로 쏟아냄
+// 켜져 있는 동안에는 cpp_project.* 카테고리의 디버그 로그도 (출력은 하지 않고) 보관함
+// 환경 변수 CPP_PROJECT_LOG_RING=<보관할 개수>가 있으면 켬 (켜지면 true)
+bool initialize();
+void installRingBuffer(int capacity);
+// 보관 중인 로그를 표준 오류로 쓰고 비움
+void dumpRingBuffer();
+
+}
+
+#endif // LOGGING_H
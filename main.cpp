@@ -1,10 +1,19 @@
 #include "mainwindow.h" // salarymanager.h에서 mainwindow.h로 변경
+#include "logging.h"
+#include "tracing.h"
 #include <QApplication>
 
 int main(int argc, char *argv[])
 {
+    Logging::initialize();            // CPP_PROJECT_LOG_RING=<개수>가 있으면 최근 로그를 보관했다가 오류 시 출력
+    Tracing::initialize(&argc, argv); // CPP_PROJECT_TRACE 또는 --trace <파일>이 있으면 추적을 켬
     QApplication a(argc, argv);
-    MainWindow w;       // SalaryManager에서 MainWindow로 변경
-    w.show();
-    return a.exec();
+    int result;
+    {
+        MainWindow w;       // SalaryManager에서 MainWindow로 변경
+        w.show();
+        result = a.exec();
+    }
+    Tracing::dump(); // 창이 닫히며 저장까지 끝난 뒤의 기록을 내보냄
+    return result;
 }
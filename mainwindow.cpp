@@ -5,13 +5,25 @@
 #include "infodisplaywidget.h"
 #include "inputworkhoursdialog.h"
 #include "datamanager.h"
+#include "refreshscheduler.h"
+#include "timeclockimporter.h"
+#include "logging.h"
+#include "tracing.h"
 #include <QMessageBox>
+#include <QApplication>
+#include <QFileDialog>
+#include <QMenu>
+#include <QMenuBar>
+#include <QAction>
 #include <QWidget>
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QCloseEvent>
 #include <QDir>
+#include <QFile>
 #include <QStandardPaths>
+#include <QShortcut>
+#include <QKeySequence>
 #include <QDebug>
 
 MainWindow::MainWindow(QWidget *parent)
@@ -54,36 +66,65 @@ MainWindow::MainWindow(QWidget *parent)
     mainVerticalLayout->addLayout(topLayout, 8);
     mainVerticalLayout->addWidget(m_infoDisplayWidget, 3);
 
+    // 갱신 스케줄러: 같은 차례에 여러 번 들어온 요청은 마지막 체크 목록으로 한 번만 반영
+    m_refreshScheduler = new RefreshScheduler(this);
+    m_calendarRefreshTarget = m_refreshScheduler->registerTarget("calendar", [this]() {
+        m_calendarWidget->setCheckedEmployeesForDisplay(m_checkedEmployeeIds);
+        m_calendarWidget->refreshDisplay();
+    });
+    m_selectionRefreshTarget = m_refreshScheduler->registerTarget("selection", [this]() {
+        m_infoDisplayWidget->updateSelectedEmployees(m_checkedEmployeeIds);
+    });
+    // 근무 기록 변경으로 표시된 달력 날짜 칸도 같은 스케줄러로 모아서 다시 그림
+    m_calendarWidget->setRefreshScheduler(m_refreshScheduler);
+
     // 시그널-슬롯 연결
     if (m_calendarWidget) {
         connect(m_calendarWidget, &CalendarWidget::dateClicked, this, &MainWindow::onCalendarDateClicked);
     }
 
+    // 파일 메뉴: 출퇴근 기록기 CSV를 한꺼번에 가져오기
+    QMenu *fileMenu = ui->menubar->addMenu("파일");
+    QAction *importAction = fileMenu->addAction("출퇴근 기록 가져오기(CSV)...");
+    connect(importAction, &QAction::triggered, this, &MainWindow::onImportTimeclock);
+
     if (m_employeePanelWidget) {
         connect(m_employeePanelWidget, &EmployeePanelWidget::checkedEmployeesChanged,
                 this, &MainWindow::onCheckedEmployeesChanged);
-        connect(m_employeePanelWidget, &EmployeePanelWidget::checkedEmployeesChanged,
-                m_infoDisplayWidget, &InfoDisplayWidget::updateSelectedEmployees);
-        connect(m_employeePanelWidget, &EmployeePanelWidget::employeeListChanged,
-                m_infoDisplayWidget, &InfoDisplayWidget::refreshEmployeeTabs);
     }
+    // 직원/근무 기록 변경은 각 위젯이 DataManager의 변경 알림을 받아 필요한 부분만 갱신함
 
-    // 데이터 로드 및 UI 초기화
-    QString dataFilePath = "salary_data.json";
-    if (m_dataManager->loadData(dataFilePath)) {
-        qDebug() << "Data loaded successfully from" << dataFilePath;
-        m_employeePanelWidget->refreshEmployeeList();
-        m_calendarWidget->setCheckedEmployeesForDisplay(m_employeePanelWidget->getCheckedEmployeeIds());
-        m_calendarWidget->refreshDisplay();
-        m_infoDisplayWidget->refreshEmployeeTabs();
-        m_infoDisplayWidget->updateSelectedEmployees(QList<int>());
+    // 데이터 로드(스냅샷 + 저널 재생) 및 UI 초기화
+    QString dataFilePath = "salary_data.dat";
+    QString legacyJsonPath = "salary_data.json";
+    if (!QFile::exists(dataFilePath) && QFile::exists(legacyJsonPath)) {
+        // 예전 JSON 저장 파일(과 그 저널)을 한 번 읽어 바이너리 스냅샷으로 변환
+        // 읽기 전용으로 열어야 예전 파일 옆에 쓰지 않을 저널이 새로 생기지 않음
+        bool migrated = false;
+        if (m_dataManager->openStore(legacyJsonPath, DataManager::ReadOnly)) {
+            m_dataManager->closeStore();
+            migrated = m_dataManager->saveData(dataFilePath);
+        }
+        if (migrated) {
+            qCInfo(lcMainWindow) << "Migrated" << legacyJsonPath << "to binary snapshot" << dataFilePath;
+        } else {
+            // 변환하지 못하면 예전 JSON 파일을 그대로 저장소로 사용
+            qCWarning(lcMainWindow) << "Couldn't migrate" << legacyJsonPath << "to" << dataFilePath
+                                    << "- keeping the JSON store";
+            dataFilePath = legacyJsonPath;
+        }
+    }
+    // openStore가 끝나면 dataReset 알림으로 직원 목록, 달력, 급여 탭이 모두 새로 그려짐
+    if (m_dataManager->openStore(dataFilePath)) {
+        qCInfo(lcMainWindow) << "Data loaded successfully from" << dataFilePath;
     } else {
-        qWarning() << "Failed to load data. Starting with empty UI.";
-        m_employeePanelWidget->refreshEmployeeList();
-        m_calendarWidget->setCheckedEmployeesForDisplay(QList<int>());
-        m_calendarWidget->refreshDisplay();
-        m_infoDisplayWidget->refreshEmployeeTabs();
-        m_infoDisplayWidget->updateSelectedEmployees(QList<int>());
+        qCWarning(lcMainWindow) << "Failed to load data. Starting with empty UI.";
+    }
+
+    // 추적이 켜져 있으면 Ctrl+Shift+T로 지금까지의 기록을 바로 파일에 씀 (종료 시에도 자동으로 씀)
+    if (Tracing::isEnabled()) {
+        QShortcut *traceShortcut = new QShortcut(QKeySequence("Ctrl+Shift+T"), this);
+        connect(traceShortcut, &QShortcut::activated, this, []() { Tracing::dump(); });
     }
 
     setWindowTitle("알바 월급 프로그램");
@@ -99,7 +140,8 @@ MainWindow::~MainWindow()
 // 날짜 클릭 시 근무시간 입력 다이얼로그 호출
 void MainWindow::onCalendarDateClicked(const QDate &date)
 {
-    qDebug() << "MainWindow: Date clicked -" << date.toString("yyyy-MM-dd");
+    TRACE_SCOPE("MainWindow::onCalendarDateClicked");
+    LOG_HOT(lcMainWindow) << "Date clicked:" << date;
 
     if (!m_employeePanelWidget || !m_dataManager) return;
 
@@ -141,33 +183,80 @@ void MainWindow::onCalendarDateClicked(const QDate &date)
                     QMessageBox::warning(this, "오류", "근무 기록 수정에 실패했습니다.");
                 }
             } else {
-                m_dataManager->addWorkLog(newLog);
-                QMessageBox::information(this, "완료", "근무 기록이 추가되었습니다.");
+                if (m_dataManager->addWorkLog(newLog)) {
+                    QMessageBox::information(this, "완료", "근무 기록이 추가되었습니다.");
+                } else {
+                    QMessageBox::warning(this, "오류", "근무 기록 추가에 실패했습니다. (지원하지 않는 날짜)");
+                }
             }
         }
-
-        // UI 갱신
-        m_calendarWidget->refreshDisplay();
-        m_infoDisplayWidget->updateAllTabs();
+        // 달력 칸과 급여 탭은 DataManager::workLogsChanged 알림으로 갱신됨
     }
 
     delete dialog;
 }
 
-// 체크된 직원 변경 시 달력 갱신
+// 출퇴근 기록기 CSV를 읽어 검사 결과를 보여 주고, 확인하면 한 번에 추가
+void MainWindow::onImportTimeclock()
+{
+    TRACE_SCOPE("MainWindow::onImportTimeclock");
+    if (!m_dataManager) return;
+
+    const QString filename = QFileDialog::getOpenFileName(this, "출퇴근 기록 가져오기", QString(),
+                                                          "CSV 파일 (*.csv *.txt);;모든 파일 (*)");
+    if (filename.isEmpty()) return;
+
+    TimeclockImporter importer(m_dataManager);
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const bool read = importer.readFile(filename);
+    QApplication::restoreOverrideCursor();
+    if (!read) {
+        QMessageBox::warning(this, "오류", "파일을 열 수 없습니다.");
+        return;
+    }
+
+    const TimeclockImporter::Statistics &stats = importer.statistics();
+    QString summary = QString("전체 %1줄 중 %2건을 추가할 수 있습니다.\n\n"
+                              "형식 오류: %3\n알 수 없는 직원: %4\n중복: %5\n시간 겹침: %6")
+                          .arg(stats.rowCount).arg(stats.acceptedCount).arg(stats.invalidCount)
+                          .arg(stats.unknownEmployeeCount).arg(stats.duplicateCount).arg(stats.overlapCount);
+    const QStringList &problems = importer.problems();
+    if (!problems.isEmpty()) {
+        const int shown = qMin(10, int(problems.size()));
+        summary += "\n\n" + problems.mid(0, shown).join("\n");
+        if (problems.size() > shown) summary += "\n...";
+    }
+
+    if (stats.acceptedCount == 0) {
+        QMessageBox::information(this, "출퇴근 기록 가져오기", summary);
+        return;
+    }
+    if (QMessageBox::question(this, "출퇴근 기록 가져오기", summary + "\n\n추가하시겠습니까?") != QMessageBox::Yes) {
+        return;
+    }
+    // 직원별 변경 알림은 달력의 칸 갱신 예약과 급여 탭 재계산으로 한 번씩만 반영됨
+    importer.commit();
+}
+
+// 체크된 직원 변경 시 달력과 집계 탭 갱신을 예약 (같은 차례의 연속 변경은 한 번으로 합쳐짐)
 void MainWindow::onCheckedEmployeesChanged(const QList<int>& checkedIds)
 {
-    qDebug() << "==> MainWindow::onCheckedEmployeesChanged - Received IDs:" << checkedIds;
-    m_calendarWidget->setCheckedEmployeesForDisplay(checkedIds);
-    m_calendarWidget->refreshDisplay();
+    LOG_HOT(lcMainWindow) << "Checked employees changed:" << checkedIds;
+    m_checkedEmployeeIds = checkedIds;
+    m_refreshScheduler->invalidate(m_calendarRefreshTarget);
+    m_refreshScheduler->invalidate(m_selectionRefreshTarget);
 }
 
-// 종료 시 데이터 저장
+// 종료 시 저장소 닫기
+// 변경 내용은 편집할 때마다 저널에 이미 기록되어 있으므로 전체 파일을 다시 쓰지 않음
 void MainWindow::closeEvent(QCloseEvent *event)
 {
-    QString dataFilePath = "salary_data.json";
-    if (!m_dataManager->saveData(dataFilePath)) {
-        qWarning() << "데이터 저장에 실패했습니다.";
+    m_dataManager->closeStore();
+
+    const auto refreshStats = m_refreshScheduler->statistics();
+    for (const auto &stats : refreshStats) {
+        qCDebug(lcMainWindow) << "Refresh" << stats.name << "- requested:" << stats.requested
+                              << "executed:" << stats.executed << "coalesced:" << stats.coalesced();
     }
     QMainWindow::closeEvent(event);
 }
@@ -3,6 +3,7 @@
 
 #include <QMainWindow>
 #include <QDate>
+#include <QList>
 
 // 주요 위젯 클래스들을 미리 선언 (전방 선언)
 class CalendarWidget;
@@ -11,6 +12,7 @@ class DataManager;
 class QHBoxLayout;
 class QVBoxLayout;
 class InfoDisplayWidget;
+class RefreshScheduler;
 
 
 namespace Ui {
@@ -35,6 +37,8 @@ private slots:
     void onCalendarDateClicked(const QDate &date);
     // 직원 목록에서 체크된 직원이 바뀌었을 때 실행
     void onCheckedEmployeesChanged(const QList<int>& checkedIndices);
+    // 파일 메뉴의 "출퇴근 기록 가져오기"를 골랐을 때 실행
+    void onImportTimeclock();
 
 private:
     Ui::MainWindow *ui; // UI 요소 관리 포인터
@@ -45,6 +49,12 @@ private:
     DataManager *m_dataManager;
     InfoDisplayWidget* m_infoDisplayWidget;
 
+    // 체크된 직원 변경처럼 연달아 일어나는 갱신 요청을 이벤트 루프 한 차례에 한 번으로 합침
+    RefreshScheduler *m_refreshScheduler;
+    int m_calendarRefreshTarget;   // 달력 전체 다시 그리기
+    int m_selectionRefreshTarget;  // 집계 탭의 선택 직원 갱신
+    QList<int> m_checkedEmployeeIds; // 가장 최근에 받은 체크된 직원 목록
+
     // 레이아웃 관리를 위한 멤버
     QWidget *m_centralArea;
     QHBoxLayout *m_mainAppLayout;
@@ -0,0 +1,318 @@
+// DataManager, 저장/불러오기, 급여 계산의 마이크로 벤치마크 (cpp_project_bench)
+// 여러 데이터 규모에서 주요 연산을 반복 측정해 실행당 중앙값/최솟값(ns/연산)을 JSON으로 출력함
+// 릴리스 사이의 성능 회귀를 비교하는 용도이므로 ctest에는 등록하지 않음
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QTemporaryDir>
+#include <QScopedPointer>
+#include <QPair>
+#include <QDebug>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include "datamanager.h"
+#include "payrollengine.h"
+#include "timeclockimporter.h"
+#include "worktimekernels.h"
+
+namespace {
+// 데이터 규모: 직원 수 × 기간(년) × 주당 근무 횟수
+struct Scale {
+    QString name;
+    int employeeCount;
+    int years;
+    int shiftsPerWeek;
+};
+
+const QList<Scale> kScales = {
+    {"small", 10, 1, 5},
+    {"medium", 50, 2, 5},
+    {"large", 200, 3, 5},
+};
+
+const QDate kFirstDay(2020, 1, 6); // 월요일
+const int kQueriesPerRun = 1000;
+
+struct BenchmarkResult {
+    QString name;
+    QString scale;
+    int employeeCount = 0;
+    qint64 shiftCount = 0;
+    qint64 operationsPerRun = 0;
+    int runs = 0;
+    double medianNsPerOperation = 0.0;
+    double minNsPerOperation = 0.0;
+};
+
+// 같은 규모에서는 항상 같은 근무 기록을 만듦 (시드 고정)
+QList<WorkLog> generateShifts(const Scale &scale, const QList<int> &employeeIds)
+{
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> dayDist(0, 6);
+    std::uniform_int_distribution<int> startDist(6 * 60, 20 * 60);
+    std::uniform_int_distribution<int> lengthDist(3 * 60, 9 * 60);
+
+    QList<WorkLog> shifts;
+    const int weeks = scale.years * 52;
+    for (int employeeId : employeeIds) {
+        for (int week = 0; week < weeks; ++week) {
+            for (int shift = 0; shift < scale.shiftsPerWeek; ++shift) {
+                const QDate date = kFirstDay.addDays(week * 7 + dayDist(rng));
+                const int start = startDist(rng);
+                const int end = (start + lengthDist(rng)) % (24 * 60); // 늦게 시작하면 자정을 넘김
+                shifts.append(WorkLog(employeeId, date, QTime(start / 60, start % 60), QTime(end / 60, end % 60)));
+            }
+        }
+    }
+    return shifts;
+}
+
+void populate(DataManager &dataManager, const Scale &scale, QList<int> *employeeIds, QList<WorkLog> *shifts)
+{
+    employeeIds->clear();
+    for (int i = 0; i < scale.employeeCount; ++i) {
+        Employee emp(-1, QString("직원%1").arg(i + 1), 10000 + (i % 10) * 500, QString("000-%1").arg(i, 6, 10, QChar('0')));
+        dataManager.addEmployee(emp);
+        employeeIds->append(emp.getId());
+    }
+    *shifts = generateShifts(scale, *employeeIds);
+    for (const WorkLog &log : std::as_const(*shifts)) {
+        dataManager.addWorkLog(log);
+    }
+}
+
+class BenchmarkRunner
+{
+public:
+    explicit BenchmarkRunner(qint64 minTimeMs) : m_minTimeNs(minTimeMs * 1000000) {}
+
+    // setup은 측정에서 빠지고 run만 측정함. 총 측정 시간이 minTime을 넘고 3회 이상 돌 때까지 반복
+    void measure(const QString &name, const Scale &scale, qint64 shiftCount, qint64 operationsPerRun,
+                 const std::function<void()> &setup, const std::function<void()> &run)
+    {
+        QList<qint64> samples;
+        qint64 totalNs = 0;
+        QElapsedTimer timer;
+        while ((samples.size() < 3 || totalNs < m_minTimeNs) && samples.size() < 1000) {
+            if (setup) setup();
+            timer.start();
+            run();
+            const qint64 elapsed = timer.nsecsElapsed();
+            samples.append(elapsed);
+            totalNs += elapsed;
+        }
+        std::sort(samples.begin(), samples.end());
+
+        BenchmarkResult result;
+        result.name = name;
+        result.scale = scale.name;
+        result.employeeCount = scale.employeeCount;
+        result.shiftCount = shiftCount;
+        result.operationsPerRun = operationsPerRun;
+        result.runs = samples.size();
+        result.medianNsPerOperation = double(samples.at(samples.size() / 2)) / operationsPerRun;
+        result.minNsPerOperation = double(samples.first()) / operationsPerRun;
+        m_results.append(result);
+
+        fprintf(stderr, "%-40s %-7s %14.1f ns/op (runs %d)\n", qPrintable(name), qPrintable(scale.name),
+                result.medianNsPerOperation, result.runs);
+    }
+
+    QJsonDocument toJson() const
+    {
+        QJsonArray results;
+        for (const BenchmarkResult &result : m_results) {
+            results.append(QJsonObject{{"name", result.name},
+                                       {"scale", result.scale},
+                                       {"employees", result.employeeCount},
+                                       {"shifts", result.shiftCount},
+                                       {"operationsPerRun", result.operationsPerRun},
+                                       {"runs", result.runs},
+                                       {"medianNsPerOp", result.medianNsPerOperation},
+                                       {"minNsPerOp", result.minNsPerOperation}});
+        }
+        return QJsonDocument(QJsonObject{
+            {"schemaVersion", 1},
+            {"timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate)},
+            {"qtVersion", QString(qVersion())},
+            {"kernelLevel", WorkTimeKernels::levelName(WorkTimeKernels::activeLevel())},
+            {"results", results}});
+    }
+
+private:
+    qint64 m_minTimeNs;
+    QList<BenchmarkResult> m_results;
+};
+
+void runScale(BenchmarkRunner &runner, const Scale &scale, const QString &tempDir)
+{
+    DataManager dataManager;
+    QList<int> employeeIds;
+    QList<WorkLog> shifts;
+    populate(dataManager, scale, &employeeIds, &shifts);
+    const qint64 shiftCount = shifts.size();
+    const QDate lastDay = kFirstDay.addDays(scale.years * 52 * 7 - 1);
+
+    // 조회 인자는 미리 만들어 두어 측정에 난수 생성이 섞이지 않게 함
+    std::mt19937 rng(777);
+    std::uniform_int_distribution<int> employeeDist(0, employeeIds.size() - 1);
+    std::uniform_int_distribution<int> dayDist(0, int(kFirstDay.daysTo(lastDay)));
+    QList<QPair<int, QDate>> queries;
+    for (int i = 0; i < kQueriesPerRun; ++i) {
+        queries.append(qMakePair(employeeIds.at(employeeDist(rng)), kFirstDay.addDays(dayDist(rng))));
+    }
+
+    volatile qint64 sink = 0;
+
+    // --- 근무 기록 추가 (빈 DataManager에 전체 근무 기록을 넣음) ---
+    QScopedPointer<DataManager> fresh;
+    auto resetFresh = [&]() {
+        fresh.reset(new DataManager);
+        for (int i = 0; i < scale.employeeCount; ++i) {
+            Employee emp(-1, QString("직원%1").arg(i + 1), 10000);
+            fresh->addEmployee(emp);
+        }
+    };
+    runner.measure("addWorkLog", scale, shiftCount, shiftCount, resetFresh, [&]() {
+        for (const WorkLog &log : std::as_const(shifts)) {
+            fresh->addWorkLog(log);
+        }
+    });
+    runner.measure("addWorkLogs", scale, shiftCount, shiftCount, resetFresh, [&]() {
+        sink += fresh->addWorkLogs(shifts);
+    });
+
+    // --- 출퇴근 기록 CSV 가져오기 (파싱, 중복/겹침 검사, 일괄 추가) ---
+    QByteArray timeclockCsv = "employee,date,in,out\n";
+    for (const WorkLog &log : std::as_const(shifts)) {
+        timeclockCsv += QByteArray::number(log.getEmployeeId()) + ',' + log.getDate().toString(Qt::ISODate).toUtf8()
+                        + ',' + log.getStartTime().toString("HH:mm").toUtf8()
+                        + ',' + log.getEndTime().toString("HH:mm").toUtf8() + '\n';
+    }
+    runner.measure("timeclockImport", scale, shiftCount, shiftCount, resetFresh, [&]() {
+        TimeclockImporter importer(fresh.data());
+        importer.readData(timeclockCsv);
+        sink += importer.commit();
+    });
+
+    // --- 조회 ---
+    runner.measure("getWorkLogsForEmployeeOnDate", scale, shiftCount, kQueriesPerRun, nullptr, [&]() {
+        for (const auto &query : std::as_const(queries)) {
+            sink += dataManager.getWorkLogsForEmployeeOnDate(query.first, query.second).size();
+        }
+    });
+    runner.measure("getWorkLogsForEmployeeForMonth", scale, shiftCount, kQueriesPerRun, nullptr, [&]() {
+        for (const auto &query : std::as_const(queries)) {
+            sink += dataManager.getWorkLogsForEmployeeForMonth(query.first, query.second.year(), query.second.month()).size();
+        }
+    });
+    runner.measure("getWorkLogsForEmployeeForMonth.totalMinutes", scale, shiftCount, kQueriesPerRun, nullptr, [&]() {
+        for (const auto &query : std::as_const(queries)) {
+            qint64 minutes = 0;
+            sink += dataManager.getWorkLogsForEmployeeForMonth(query.first, query.second.year(), query.second.month(),
+                                                              &minutes).size();
+            sink += minutes;
+        }
+    });
+
+    // --- 근무 시간 합계와 급여(주휴수당 포함) 계산 ---
+    runner.measure("totalMinutes.month", scale, shiftCount, kQueriesPerRun, nullptr, [&]() {
+        for (const auto &query : std::as_const(queries)) {
+            const QDate first(query.second.year(), query.second.month(), 1);
+            sink += dataManager.getTotalMinutesForEmployee(query.first, first, first.addMonths(1).addDays(-1));
+        }
+    });
+    const DataSnapshot snapshot = dataManager.snapshot();
+    const QDate monthStart(lastDay.year(), lastDay.month(), 1);
+    runner.measure("payroll.month", scale, shiftCount, employeeIds.size(), nullptr, [&]() {
+        sink += PayrollEngine::compute(snapshot, monthStart, lastDay, employeeIds).totals.netPay;
+    });
+    runner.measure("payroll.fullPeriod", scale, shiftCount, employeeIds.size(), nullptr, [&]() {
+        sink += PayrollEngine::compute(snapshot, kFirstDay, lastDay, employeeIds).totals.netPay;
+    });
+
+    // --- 저장/불러오기 (JSON, 바이너리) ---
+    const QString jsonPath = tempDir + "/" + scale.name + ".json";
+    const QString binaryPath = tempDir + "/" + scale.name + ".dat";
+    runner.measure("saveData.json", scale, shiftCount, shiftCount, nullptr, [&]() { dataManager.saveData(jsonPath); });
+    runner.measure("saveData.binary", scale, shiftCount, shiftCount, nullptr, [&]() { dataManager.saveData(binaryPath); });
+    DataManager loaded;
+    runner.measure("loadData.json", scale, shiftCount, shiftCount, nullptr, [&]() { loaded.loadData(jsonPath); });
+    runner.measure("loadData.binary", scale, shiftCount, shiftCount, nullptr, [&]() { loaded.loadData(binaryPath); });
+
+    // --- 직원 삭제 (직원과 그 근무 기록을 모두 지움) ---
+    runner.measure("deleteEmployeeById", scale, shiftCount, employeeIds.size(),
+        [&]() { loaded.loadData(binaryPath); },
+        [&]() {
+            for (int employeeId : std::as_const(employeeIds)) {
+                loaded.deleteEmployeeById(employeeId);
+            }
+        });
+}
+
+// DataManager가 연산마다 남기는 디버그 로그는 측정을 흐리므로 경고 이상만 출력
+void quietMessageHandler(QtMsgType type, const QMessageLogContext &, const QString &message)
+{
+    if (type == QtDebugMsg || type == QtInfoMsg) return;
+    fprintf(stderr, "%s\n", qPrintable(message));
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("cpp_project_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("DataManager, 저장/불러오기, 급여 계산 벤치마크");
+    parser.addHelpOption();
+    const QCommandLineOption scalesOption("scales", "측정할 규모 (small,medium,large, 기본: 전체)", "names");
+    const QCommandLineOption outputOption({"o", "output"}, "JSON 결과 파일 (기본: 표준 출력)", "file");
+    const QCommandLineOption minTimeOption("min-time", "벤치마크당 최소 측정 시간 (밀리초, 기본: 200)", "ms", "200");
+    parser.addOptions({scalesOption, outputOption, minTimeOption});
+    parser.process(app);
+
+    qInstallMessageHandler(quietMessageHandler);
+
+    QList<Scale> scales = kScales;
+    if (parser.isSet(scalesOption)) {
+        const QStringList names = parser.value(scalesOption).split(',', Qt::SkipEmptyParts);
+        scales.erase(std::remove_if(scales.begin(), scales.end(),
+                                    [&](const Scale &scale) { return !names.contains(scale.name); }),
+                     scales.end());
+    }
+    if (scales.isEmpty()) {
+        qWarning() << "No matching scale:" << parser.value(scalesOption);
+        return 1;
+    }
+
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        qWarning() << "Couldn't create a temporary directory:" << tempDir.errorString();
+        return 1;
+    }
+
+    BenchmarkRunner runner(parser.value(minTimeOption).toLongLong());
+    for (const Scale &scale : std::as_const(scales)) {
+        runScale(runner, scale, tempDir.path());
+    }
+
+    const QByteArray json = runner.toJson().toJson(QJsonDocument::Indented);
+    if (parser.isSet(outputOption)) {
+        QFile outputFile(parser.value(outputOption));
+        if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || outputFile.write(json) != json.size()) {
+            qWarning() << "Failed to write" << parser.value(outputOption) << ":" << outputFile.errorString();
+            return 1;
+        }
+    } else {
+        fwrite(json.constData(), 1, size_t(json.size()), stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "payrollcalculator.h"
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrentRun>
+
+PayrollCalculator::PayrollCalculator(QObject *parent)
+    : QObject(parent), m_generation(0), m_running(false)
+{
+}
+
+PayrollCalculator::~PayrollCalculator()
+{
+    // 작업 스레드는 스냅샷 사본만 쓰므로 기다리지 않고 취소만 알림
+    cancel();
+}
+
+void PayrollCalculator::request(const DataSnapshot &snapshot, const QDate &startDate, const QDate &endDate,
+                                const QList<int> &employeeIds)
+{
+    cancel();
+
+    const quint64 generation = ++m_generation;
+    QSharedPointer<QAtomicInt> cancelToken(new QAtomicInt(0));
+    m_cancelToken = cancelToken;
+    m_running = true;
+
+    auto *watcher = new QFutureWatcher<PayrollResult>(this);
+    connect(watcher, &QFutureWatcher<PayrollResult>::finished, this, [this, watcher, generation]() {
+        watcher->deleteLater();
+        if (generation != m_generation) return; // 더 새로운 요청이 있음
+
+        m_running = false;
+        const PayrollResult result = watcher->result();
+        if (result.cancelled) return;
+        emit resultReady(result);
+    });
+
+    watcher->setFuture(QtConcurrent::run([snapshot, startDate, endDate, employeeIds, cancelToken]() {
+        return PayrollEngine::compute(snapshot, startDate, endDate, employeeIds, cancelToken.data());
+    }));
+}
+
+void PayrollCalculator::cancel()
+{
+    if (m_cancelToken) {
+        m_cancelToken->storeRelaxed(1);
+        m_cancelToken.reset();
+    }
+    if (m_running) {
+        ++m_generation; // 진행 중이던 요청의 결과는 무시
+        m_running = false;
+    }
+}
+
+bool PayrollCalculator::isRunning() const
+{
+    return m_running;
+}
@@ -0,0 +1,35 @@
+#ifndef PAYROLLCALCULATOR_H
+#define PAYROLLCALCULATOR_H
+
+#include <QObject>
+#include <QSharedPointer>
+#include "datasnapshot.h"
+#include "payrollengine.h"
+
+// 급여 계산을 GUI 스레드 밖(QtConcurrent 스레드 풀)에서 실행하고 결과를 시그널로 돌려주는 클래스
+// 새 요청이 들어오면 진행 중인 계산은 취소되고, 늦게 끝난 이전 결과는 버려짐
+class PayrollCalculator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PayrollCalculator(QObject *parent = nullptr);
+    ~PayrollCalculator();
+
+    // 스냅샷 기준으로 급여 계산 시작 (이전 요청을 대체함)
+    void request(const DataSnapshot &snapshot, const QDate &startDate, const QDate &endDate,
+                 const QList<int> &employeeIds);
+    void cancel(); // 진행 중인 계산 취소 (결과 시그널이 나가지 않음)
+    bool isRunning() const;
+
+signals:
+    // 가장 최근 요청의 계산이 끝났을 때 GUI 스레드에서 발생
+    void resultReady(const PayrollResult &result);
+
+private:
+    quint64 m_generation;                  // 요청마다 증가, 오래된 결과를 거르는 데 사용
+    QSharedPointer<QAtomicInt> m_cancelToken; // 현재 요청의 취소 플래그 (작업 스레드와 공유)
+    bool m_running;
+};
+
+#endif // PAYROLLCALCULATOR_H
@@ -0,0 +1,200 @@
+// 화면 없이 급여를 계산하는 명령줄 실행 파일 (cpp_project_cli)
+// 저장 파일(.json 또는 바이너리 스냅샷 + 저널)을 읽어 InfoDisplayWidget과 같은 PayrollEngine 규칙으로
+// 기간 급여를 계산하고 CSV/JSON으로 출력함. 서버나 cron에서 여러 저장 파일을 동시에 처리하는 용도
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include <QDebug>
+#include <cstdio>
+#include "datamanager.h"
+#include "payrollengine.h"
+#include "logging.h"
+#include "tracing.h"
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+// 프로세스의 최대 상주 메모리 (KiB, 알 수 없으면 -1)
+qint64 peakMemoryKiB()
+{
+#ifdef Q_OS_WIN
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return -1;
+    return qint64(counters.PeakWorkingSetSize / 1024);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+#ifdef Q_OS_MACOS
+    return qint64(usage.ru_maxrss / 1024); // macOS는 바이트 단위
+#else
+    return qint64(usage.ru_maxrss);        // Linux는 KiB 단위
+#endif
+#endif
+}
+
+QString csvField(const QString &value)
+{
+    if (!value.contains(',') && !value.contains('"') && !value.contains('\n')) return value;
+    QString quoted = value;
+    quoted.replace("\"", "\"\"");
+    return "\"" + quoted + "\"";
+}
+
+QByteArray formatCsv(const PayrollResult &result)
+{
+    QString text;
+    QTextStream out(&text);
+    out << "employeeId,name,hourlyWage,minutes,hours,basicPay,weeklyHolidayPay,tax,netPay\n";
+    for (const PayrollLine &line : result.lines) {
+        out << line.employeeId << ',' << csvField(line.name) << ',' << line.hourlyWage << ','
+            << line.minutes << ',' << QString::number(line.hours(), 'f', 2) << ','
+            << line.basicPay << ',' << line.weeklyHolidayPay << ',' << line.tax << ',' << line.netPay << '\n';
+    }
+    const PayrollTotals &totals = result.totals;
+    out << "total," << totals.employeeCount << ",," << totals.minutes << ','
+        << QString::number(totals.hours(), 'f', 2) << ',' << totals.basicPay << ','
+        << totals.weeklyHolidayPay << ',' << totals.tax << ',' << totals.netPay << '\n';
+    out.flush();
+    return text.toUtf8();
+}
+
+QByteArray formatJson(const PayrollResult &result)
+{
+    QJsonArray lines;
+    for (const PayrollLine &line : result.lines) {
+        lines.append(QJsonObject{{"employeeId", line.employeeId},
+                                 {"name", line.name},
+                                 {"hourlyWage", line.hourlyWage},
+                                 {"minutes", line.minutes},
+                                 {"basicPay", line.basicPay},
+                                 {"weeklyHolidayPay", line.weeklyHolidayPay},
+                                 {"tax", line.tax},
+                                 {"netPay", line.netPay}});
+    }
+    const PayrollTotals &totals = result.totals;
+    QJsonObject root{{"startDate", result.startDate.toString(Qt::ISODate)},
+                     {"endDate", result.endDate.toString(Qt::ISODate)},
+                     {"lines", lines},
+                     {"totals", QJsonObject{{"employeeCount", totals.employeeCount},
+                                            {"minutes", totals.minutes},
+                                            {"basicPay", totals.basicPay},
+                                            {"weeklyHolidayPay", totals.weeklyHolidayPay},
+                                            {"tax", totals.tax},
+                                            {"netPay", totals.netPay}}}};
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+// "1,2,5" 형식의 직원 ID 목록 (잘못된 값이 있으면 false)
+bool parseEmployeeIds(const QString &text, QList<int> *employeeIds)
+{
+    const QStringList parts = text.split(',', Qt::SkipEmptyParts);
+    for (const QString &part : parts) {
+        bool ok = false;
+        const int employeeId = part.trimmed().toInt(&ok);
+        if (!ok) return false;
+        employeeIds->append(employeeId);
+    }
+    return true;
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QElapsedTimer wallTimer;
+    wallTimer.start();
+
+    Logging::initialize();            // CPP_PROJECT_LOG_RING=<개수>
+    Tracing::initialize(&argc, argv); // CPP_PROJECT_TRACE 또는 --trace <파일>
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("cpp_project_cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("저장 파일을 읽어 기간 급여를 계산합니다.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("file", "저장 파일 (salary_data.json, salary_data.dat 등). 저널이 있으면 함께 재생");
+    const QCommandLineOption fromOption("from", "기간 시작일 (기본: 이번 달 1일)", "yyyy-MM-dd");
+    const QCommandLineOption toOption("to", "기간 종료일 (기본: 이번 달 말일)", "yyyy-MM-dd");
+    const QCommandLineOption employeesOption("employees", "계산할 직원 ID 목록 (기본: 전체)", "id,id,...");
+    const QCommandLineOption formatOption("format", "출력 형식: csv 또는 json (기본: csv)", "format", "csv");
+    const QCommandLineOption outputOption({"o", "output"}, "결과를 쓸 파일 (기본: 표준 출력)", "file");
+    const QCommandLineOption statsOption("stats", "소요 시간과 최대 메모리 사용량을 표준 오류로 출력");
+    parser.addOptions({fromOption, toOption, employeesOption, formatOption, outputOption, statsOption});
+    parser.process(app);
+
+    const QStringList positional = parser.positionalArguments();
+    if (positional.size() != 1) {
+        parser.showHelp(1);
+    }
+    const QString dataPath = positional.first();
+
+    const QDate today = QDate::currentDate();
+    QDate startDate(today.year(), today.month(), 1);
+    QDate endDate(today.year(), today.month(), today.daysInMonth());
+    if (parser.isSet(fromOption)) startDate = QDate::fromString(parser.value(fromOption), Qt::ISODate);
+    if (parser.isSet(toOption)) endDate = QDate::fromString(parser.value(toOption), Qt::ISODate);
+    if (!startDate.isValid() || !endDate.isValid() || startDate > endDate) {
+        qWarning() << "Invalid period:" << parser.value(fromOption) << "~" << parser.value(toOption);
+        return 1;
+    }
+
+    const QString format = parser.value(formatOption).toLower();
+    if (format != "csv" && format != "json") {
+        qWarning() << "Unknown output format:" << format;
+        return 1;
+    }
+
+    QElapsedTimer stepTimer;
+    stepTimer.start();
+    DataManager dataManager;
+    if (!dataManager.openStore(dataPath, DataManager::ReadOnly)) {
+        qWarning() << "Failed to load" << dataPath;
+        return 1;
+    }
+    const qint64 loadMs = stepTimer.restart();
+
+    QList<int> employeeIds;
+    if (parser.isSet(employeesOption)) {
+        if (!parseEmployeeIds(parser.value(employeesOption), &employeeIds)) {
+            qWarning() << "Invalid employee ID list:" << parser.value(employeesOption);
+            return 1;
+        }
+    } else {
+        for (const Employee &emp : dataManager.getEmployees()) {
+            employeeIds.append(emp.getId());
+        }
+    }
+
+    const PayrollResult result = PayrollEngine::compute(dataManager.snapshot(), startDate, endDate, employeeIds);
+    const qint64 computeMs = stepTimer.restart();
+
+    const QByteArray output = (format == "json") ? formatJson(result) : formatCsv(result);
+    if (parser.isSet(outputOption)) {
+        QFile outputFile(parser.value(outputOption));
+        if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || outputFile.write(output) != output.size()) {
+            qWarning() << "Failed to write" << parser.value(outputOption) << ":" << outputFile.errorString();
+            return 1;
+        }
+    } else {
+        fwrite(output.constData(), 1, size_t(output.size()), stdout);
+        fflush(stdout);
+    }
+
+    if (parser.isSet(statsOption)) {
+        fprintf(stderr, "file=%s employees=%d load_ms=%lld compute_ms=%lld wall_ms=%lld peak_rss_kib=%lld\n",
+                qPrintable(dataPath), int(result.lines.size()), static_cast<long long>(loadMs),
+                static_cast<long long>(computeMs), static_cast<long long>(wallTimer.elapsed()),
+                static_cast<long long>(peakMemoryKiB()));
+    }
+    Tracing::dump();
+    return 0;
+}
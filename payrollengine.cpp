@@ -0,0 +1,141 @@
+#include "payrollengine.h"
+#include "datasnapshot.h"
+#include "tracing.h"
+
+const PayrollLine* PayrollResult::line(int employeeId) const
+{
+    auto it = lineIndexById.constFind(employeeId);
+    return it != lineIndexById.constEnd() ? &lines.at(it.value()) : nullptr;
+}
+
+bool PayrollResult::contains(int employeeId) const
+{
+    return lineIndexById.contains(employeeId);
+}
+
+PayrollTotals PayrollResult::totalsFor(const QList<int>& employeeIds) const
+{
+    QList<const PayrollLine*> selected;
+    selected.reserve(employeeIds.size());
+    for (int employeeId : employeeIds) {
+        if (const PayrollLine* found = line(employeeId)) {
+            selected.append(found);
+        }
+    }
+    return PayrollEngine::sumLines(selected);
+}
+
+void PayrollResult::merge(const PayrollResult& partial)
+{
+    for (const PayrollLine& updated : partial.lines) {
+        auto it = lineIndexById.constFind(updated.employeeId);
+        if (it != lineIndexById.constEnd()) {
+            lines[it.value()] = updated;
+        } else {
+            lineIndexById.insert(updated.employeeId, lines.size());
+            lines.append(updated);
+        }
+    }
+    totals = totalsFor(lineIndexById.keys());
+}
+
+void PayrollResult::removeLine(int employeeId)
+{
+    auto it = lineIndexById.constFind(employeeId);
+    if (it == lineIndexById.constEnd()) return;
+
+    lines.removeAt(it.value());
+    lineIndexById.clear();
+    for (int i = 0; i < lines.size(); ++i) {
+        lineIndexById.insert(lines.at(i).employeeId, i);
+    }
+    totals = totalsFor(lineIndexById.keys());
+}
+
+PayrollResult PayrollEngine::compute(const DataSnapshot& data, const QDate& startDate, const QDate& endDate,
+                                     const QList<int>& employeeIds, const QAtomicInt* cancelRequested)
+{
+    TRACE_SCOPE("PayrollEngine::compute");
+    PayrollResult result;
+    result.startDate = startDate;
+    result.endDate = endDate;
+    result.lines.reserve(employeeIds.size());
+
+    const bool validPeriod = startDate.isValid() && endDate.isValid();
+    const qint64 fromDay = validPeriod ? startDate.toJulianDay() : 0;
+    const qint64 toDay = validPeriod ? endDate.toJulianDay() : -1;
+
+    for (int employeeId : employeeIds) {
+        if (cancelRequested && cancelRequested->loadRelaxed() != 0) {
+            result.cancelled = true;
+            return result;
+        }
+        if (result.lineIndexById.contains(employeeId)) continue; // 중복 ID는 한 번만
+        const Employee* emp = data.findEmployee(employeeId);
+        if (!emp) continue;
+
+        PayrollLine line;
+        line.employeeId = employeeId;
+        line.name = emp->getName();
+        line.hourlyWage = emp->getHourlyWage();
+
+        // 주별 합계를 한 번 훑으면서 총 근무분과 주휴수당 대상 근무분을 같이 누적
+        // (금액은 분을 다 더한 뒤 한 번만 계산하므로 주마다 절사 오차가 쌓이지 않음)
+        const WorkTimeIndex* index = data.findWorkTimeIndex(employeeId);
+        qint64 qualifyingMinutes = 0;
+        if (index && validPeriod) {
+            const auto weeks = index->weeklyMinutes(fromDay, toDay);
+            for (const auto& week : weeks) {
+                line.minutes += week.second;
+                if (week.second >= kWeeklyHolidayMinMinutes) {
+                    qualifyingMinutes += week.second;
+                }
+            }
+        }
+
+        line.basicPay = payForMinutes(line.minutes, line.hourlyWage);
+        line.weeklyHolidayPay = holidayPayForMinutes(qualifyingMinutes, line.hourlyWage);
+        line.tax = withholdingFor(line.basicPay + line.weeklyHolidayPay);
+        line.netPay = line.basicPay + line.weeklyHolidayPay - line.tax;
+
+        result.lineIndexById.insert(employeeId, result.lines.size());
+        result.lines.append(line);
+    }
+
+    QList<const PayrollLine*> all;
+    all.reserve(result.lines.size());
+    for (const PayrollLine& line : result.lines) {
+        all.append(&line);
+    }
+    result.totals = sumLines(all);
+    return result;
+}
+
+qint64 PayrollEngine::payForMinutes(qint64 minutes, int hourlyWage)
+{
+    return minutes * hourlyWage / 60;
+}
+
+qint64 PayrollEngine::holidayPayForMinutes(qint64 qualifyingMinutes, int hourlyWage)
+{
+    return qualifyingMinutes * hourlyWage / (60 * kWeeklyHolidayDivisor);
+}
+
+qint64 PayrollEngine::withholdingFor(qint64 grossPay)
+{
+    return grossPay * kWithholdingPerMille / 1000;
+}
+
+PayrollTotals PayrollEngine::sumLines(const QList<const PayrollLine*>& lines)
+{
+    PayrollTotals totals;
+    for (const PayrollLine* line : lines) {
+        ++totals.employeeCount;
+        totals.minutes += line->minutes;
+        totals.basicPay += line->basicPay;
+        totals.weeklyHolidayPay += line->weeklyHolidayPay;
+        totals.tax += line->tax;
+        totals.netPay += line->netPay;
+    }
+    return totals;
+}
@@ -0,0 +1,85 @@
+#ifndef PAYROLLENGINE_H
+#define PAYROLLENGINE_H
+
+#include <QAtomicInt>
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <QString>
+
+class DataSnapshot;
+
+// 직원 한 명의 기간 급여 계산 결과
+// 근무시간은 분, 금액은 원 단위 정수로 계산하므로 합산해도 오차가 생기지 않음
+struct PayrollLine {
+    int employeeId = -1;
+    QString name;
+    int hourlyWage = 0;
+    qint64 minutes = 0;          // 기간 내 총 근무시간(분)
+    qint64 basicPay = 0;         // 근무시간 급여 (원)
+    qint64 weeklyHolidayPay = 0; // 주휴수당 (원)
+    qint64 tax = 0;              // 원천징수 3.3% (원)
+    qint64 netPay = 0;           // 실수령액 (원)
+
+    double hours() const { return static_cast<double>(minutes) / 60.0; } // 표시용
+};
+
+// 여러 직원의 합계 (각 직원 금액을 그대로 더하므로 직원별 명세와 원 단위까지 일치)
+struct PayrollTotals {
+    int employeeCount = 0;
+    qint64 minutes = 0;
+    qint64 basicPay = 0;
+    qint64 weeklyHolidayPay = 0;
+    qint64 tax = 0;
+    qint64 netPay = 0;
+
+    double hours() const { return static_cast<double>(minutes) / 60.0; }
+};
+
+// 기간과 직원 목록에 대한 급여 계산표
+struct PayrollResult {
+    QDate startDate;
+    QDate endDate;
+    QList<PayrollLine> lines;      // 요청한 직원 순서대로 (없는 직원은 제외)
+    PayrollTotals totals;          // lines 전체의 합계
+    bool cancelled = false;        // 계산 도중 취소되어 내용이 불완전함
+
+    const PayrollLine* line(int employeeId) const; // 해당 직원의 계산 결과 (없으면 nullptr)
+    bool contains(int employeeId) const;
+    PayrollTotals totalsFor(const QList<int>& employeeIds) const; // 일부 직원만의 합계
+    // 일부 직원만 다시 계산한 결과를 반영 (같은 직원은 교체, 새 직원은 추가) 후 합계 재계산
+    void merge(const PayrollResult& partial);
+    void removeLine(int employeeId); // 직원 한 명의 결과를 빼고 합계 재계산
+
+    QHash<int, int> lineIndexById; // 직원 ID → lines 위치
+};
+
+// 화면과 분리된 급여 계산기
+// 직원마다 주 단위 근무 시간 색인을 한 번만 훑어서 총 근무시간과 주휴수당을 함께 구함
+// 읽기 전용 스냅샷만 사용하므로 작업 스레드에서 호출해도 됨
+//
+// 반올림 규칙 (모두 원 미만 절사, 직원별로 한 번씩만 적용):
+//   근무시간 급여 = 총 근무분 * 시급 / 60
+//   주휴수당     = (주 15시간 이상인 주의 근무분 합) * 시급 / 60 * 0.2
+//   세금         = (근무시간 급여 + 주휴수당) * 33 / 1000
+//   실수령액     = 근무시간 급여 + 주휴수당 - 세금
+class PayrollEngine
+{
+public:
+    static constexpr qint64 kWithholdingPerMille = 33;          // 사업소득 원천징수 3.3% (천분율)
+    static constexpr qint64 kWeeklyHolidayMinMinutes = 15 * 60; // 주휴수당 지급 기준 (주 15시간 이상)
+    static constexpr qint64 kWeeklyHolidayDivisor = 5;          // 주휴수당 = 그 주 급여 * 0.2 (= 1/5)
+
+    // 금액 계산 단계별 함수 (원 미만 절사)
+    static qint64 payForMinutes(qint64 minutes, int hourlyWage);
+    static qint64 holidayPayForMinutes(qint64 qualifyingMinutes, int hourlyWage);
+    static qint64 withholdingFor(qint64 grossPay);
+
+    // cancelRequested가 0이 아니게 되면 다음 직원으로 넘어가기 전에 멈추고 cancelled를 표시해 반환
+    static PayrollResult compute(const DataSnapshot& data, const QDate& startDate, const QDate& endDate,
+                                 const QList<int>& employeeIds, const QAtomicInt* cancelRequested = nullptr);
+
+    static PayrollTotals sumLines(const QList<const PayrollLine*>& lines);
+};
+
+#endif // PAYROLLENGINE_H
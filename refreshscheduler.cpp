@@ -0,0 +1,64 @@
+#include "refreshscheduler.h"
+#include "tracing.h"
+#include <QTimer>
+
+RefreshScheduler::RefreshScheduler(QObject *parent)
+    : QObject(parent), m_flushScheduled(false)
+{
+}
+
+int RefreshScheduler::registerTarget(const QString &name, std::function<void()> refresh)
+{
+    Target target;
+    target.stats.name = name;
+    target.refresh = std::move(refresh);
+    m_targets.append(target);
+    return m_targets.size() - 1;
+}
+
+void RefreshScheduler::invalidate(int targetId)
+{
+    if (targetId < 0 || targetId >= m_targets.size()) return;
+
+    Target &target = m_targets[targetId];
+    ++target.stats.requested;
+    target.dirty = true;
+
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        QTimer::singleShot(0, this, &RefreshScheduler::flush);
+    }
+}
+
+void RefreshScheduler::flush()
+{
+    TRACE_SCOPE("RefreshScheduler::flush");
+    m_flushScheduled = false;
+
+    // 갱신 중에 다시 invalidate되는 대상은 다음 차례에 실행되도록 먼저 표시를 지움
+    for (int i = 0; i < m_targets.size(); ++i) {
+        if (!m_targets[i].dirty) continue;
+        m_targets[i].dirty = false;
+        ++m_targets[i].stats.executed;
+        m_targets[i].refresh();
+    }
+}
+
+QList<RefreshScheduler::TargetStatistics> RefreshScheduler::statistics() const
+{
+    QList<TargetStatistics> stats;
+    stats.reserve(m_targets.size());
+    for (const Target &target : m_targets) {
+        stats.append(target.stats);
+    }
+    return stats;
+}
+
+quint64 RefreshScheduler::totalCoalesced() const
+{
+    quint64 total = 0;
+    for (const Target &target : m_targets) {
+        total += target.stats.coalesced();
+    }
+    return total;
+}
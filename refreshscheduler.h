@@ -0,0 +1,47 @@
+#ifndef REFRESHSCHEDULER_H
+#define REFRESHSCHEDULER_H
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <functional>
+
+// 여러 위젯의 "다시 그려야 함" 요청을 모아 두었다가 이벤트 루프 한 차례에 대상마다 한 번씩만 실행하는 클래스
+// 한 번의 사용자 동작이 시그널을 여러 번 일으켜도 화면 갱신은 한 번으로 합쳐짐 (합쳐진 횟수는 통계로 남김)
+class RefreshScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    // 대상별 요청/실행 횟수
+    struct TargetStatistics {
+        QString name;
+        quint64 requested = 0; // invalidate 호출 수
+        quint64 executed = 0;  // 실제 갱신 실행 수
+        quint64 coalesced() const { return requested - executed; } // 합쳐져서 생략된 갱신 수
+    };
+
+    explicit RefreshScheduler(QObject *parent = nullptr);
+
+    // 갱신 대상을 등록하고 대상 번호를 돌려줌 (refresh는 GUI 스레드에서 호출됨)
+    int registerTarget(const QString &name, std::function<void()> refresh);
+    // 대상을 갱신 필요 상태로 표시 (같은 차례 안의 중복 요청은 한 번으로 합쳐짐)
+    void invalidate(int targetId);
+    // 표시된 대상을 지금 바로 갱신 (예약된 실행은 할 일이 없으면 그냥 끝남)
+    void flush();
+
+    QList<TargetStatistics> statistics() const;
+    quint64 totalCoalesced() const; // 모든 대상에서 합쳐진 갱신 수
+
+private:
+    struct Target {
+        TargetStatistics stats;
+        std::function<void()> refresh;
+        bool dirty = false;
+    };
+
+    QList<Target> m_targets;
+    bool m_flushScheduled; // 이번 이벤트 루프 차례에 flush가 예약되어 있는지
+};
+
+#endif // REFRESHSCHEDULER_H
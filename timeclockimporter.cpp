@@ -0,0 +1,465 @@
+#include "timeclockimporter.h"
+#include "datamanager.h"
+#include "worklogcolumns.h"
+#include "worktimeindex.h"
+#include "logging.h"
+#include "tracing.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSet>
+#include <QThread>
+#include <QVector>
+#include <QtConcurrent/QtConcurrentMap>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// 이보다 작은 파일은 스레드에 나눠 주는 비용이 더 크므로 한 번에 파싱
+const qint64 kParallelParseMinBytes = 256 * 1024;
+const int kMinutesPerDay = 24 * 60;
+const int kFieldCount = 4; // 직원 코드, 날짜, 출근, 퇴근
+
+enum class RowError {
+    None,
+    FieldCount,
+    Date,
+    DateRange,
+    StartTime,
+    EndTime,
+    ZeroLength
+};
+
+struct ParsedRow {
+    int line = 0; // 청크 안의 줄 번호 (0부터)
+    QByteArray code;
+    qint32 day = 0;
+    qint16 startMinute = 0;
+    qint16 endMinute = 0;
+    RowError error = RowError::None;
+};
+
+// 파일의 [begin, end) 구간. 항상 줄의 시작에서 시작하고 줄바꿈 바로 뒤(또는 파일 끝)에서 끝남
+struct Chunk {
+    qint64 begin = 0;
+    qint64 end = 0;
+    bool isFirst = false; // 머리글이 있을 수 있는 첫 청크
+    int lineCount = 0;
+    QVector<ParsedRow> rows;
+};
+
+// 숫자로만 된 [begin, end) 구간을 정수로 (비었거나 숫자가 아닌 문자가 있으면 -1)
+int parseDigits(const char *begin, const char *end)
+{
+    if (begin == end || end - begin > 9) return -1;
+    int value = 0;
+    for (const char *p = begin; p < end; ++p) {
+        if (*p < '0' || *p > '9') return -1;
+        value = value * 10 + (*p - '0');
+    }
+    return value;
+}
+
+// yyyy-MM-dd 또는 yyyy/MM/dd
+bool parseDate(const QByteArray &text, qint32 *day)
+{
+    if (text.size() != 10) return false;
+    const char *s = text.constData();
+    const char separator = s[4];
+    if ((separator != '-' && separator != '/') || s[7] != separator) return false;
+    const QDate date(parseDigits(s, s + 4), parseDigits(s + 5, s + 7), parseDigits(s + 8, s + 10));
+    if (!date.isValid()) return false;
+    *day = WorkLogColumns::encodeDate(date);
+    return true;
+}
+
+// H:mm, HH:mm, H:mm:ss, HH:mm:ss (초는 버림, 퇴근 시각의 24:00은 자정으로 봄)
+bool parseTime(const QByteArray &text, qint16 *minute)
+{
+    const char *s = text.constData();
+    const char *end = s + text.size();
+    const char *hourEnd = std::find(s, end, ':');
+    if (hourEnd == end || hourEnd - s < 1 || hourEnd - s > 2) return false;
+    const char *minuteEnd = std::find(hourEnd + 1, end, ':');
+    if (minuteEnd - (hourEnd + 1) != 2) return false;
+    if (minuteEnd != end) {
+        const int seconds = parseDigits(minuteEnd + 1, end);
+        if (end - (minuteEnd + 1) != 2 || seconds < 0 || seconds > 59) return false;
+    }
+
+    const int hours = parseDigits(s, hourEnd);
+    const int minutes = parseDigits(hourEnd + 1, minuteEnd);
+    if (hours == 24 && minutes == 0) {
+        *minute = 0;
+        return true;
+    }
+    if (hours < 0 || hours > 23 || minutes < 0 || minutes > 59) return false;
+    *minute = static_cast<qint16>(hours * 60 + minutes);
+    return true;
+}
+
+// 줄을 쉼표로 나눠 앞의 maxFields칸만 fields에 담고 칸 수를 반환
+// 큰따옴표로 감싼 칸("" 이스케이프 포함)을 지원하고, 감싸지 않은 칸은 앞뒤 공백을 뺌
+int splitFields(const char *begin, const char *end, QByteArray *fields, int maxFields)
+{
+    int count = 0;
+    const char *p = begin;
+    while (count < maxFields) {
+        while (p < end && (*p == ' ' || *p == '\t')) ++p;
+        QByteArray &field = fields[count++];
+        field.clear();
+        if (p < end && *p == '"') {
+            for (++p; p < end; ++p) {
+                if (*p == '"') {
+                    if (p + 1 < end && p[1] == '"') {
+                        field += '"';
+                        ++p;
+                        continue;
+                    }
+                    ++p;
+                    break;
+                }
+                field += *p;
+            }
+            while (p < end && *p != ',') ++p;
+        } else {
+            const char *fieldBegin = p;
+            while (p < end && *p != ',') ++p;
+            const char *fieldEnd = p;
+            while (fieldEnd > fieldBegin && (fieldEnd[-1] == ' ' || fieldEnd[-1] == '\t')) --fieldEnd;
+            field = QByteArray(fieldBegin, int(fieldEnd - fieldBegin));
+        }
+        if (p >= end) break;
+        ++p; // 구분 ','
+    }
+    return count;
+}
+
+void parseChunk(const char *data, Chunk &chunk)
+{
+    QByteArray fields[kFieldCount];
+    const char *p = data + chunk.begin;
+    const char *end = data + chunk.end;
+    bool headerChecked = !chunk.isFirst;
+    int line = 0;
+    while (p < end) {
+        const char *lineBegin = p;
+        const char *lineEnd = static_cast<const char *>(std::memchr(p, '\n', size_t(end - p)));
+        p = lineEnd ? lineEnd + 1 : end;
+        if (!lineEnd) lineEnd = end;
+        if (lineEnd > lineBegin && lineEnd[-1] == '\r') --lineEnd;
+        const int lineIndex = line++;
+
+        const char *firstChar = lineBegin;
+        while (firstChar < lineEnd && (*firstChar == ' ' || *firstChar == '\t')) ++firstChar;
+        if (firstChar == lineEnd) continue; // 빈 줄
+
+        ParsedRow row;
+        row.line = lineIndex;
+        const int fieldCount = splitFields(lineBegin, lineEnd, fields, kFieldCount);
+        if (fieldCount < kFieldCount) {
+            row.error = RowError::FieldCount;
+        } else if (!parseDate(fields[1], &row.day)) {
+            if (!headerChecked) {
+                headerChecked = true;
+                continue; // 첫 줄의 날짜 칸이 날짜가 아니면 머리글
+            }
+            row.error = RowError::Date;
+        } else if (!WorkTimeIndex::isSupportedDay(row.day)) {
+            row.error = RowError::DateRange;
+        } else if (!parseTime(fields[2], &row.startMinute)) {
+            row.error = RowError::StartTime;
+        } else if (!parseTime(fields[3], &row.endMinute)) {
+            row.error = RowError::EndTime;
+        } else if (row.startMinute == row.endMinute) {
+            row.error = RowError::ZeroLength;
+        }
+        headerChecked = true;
+        row.code = fields[0];
+        chunk.rows.append(row);
+    }
+    chunk.lineCount = line;
+}
+
+QString rowErrorText(RowError error)
+{
+    switch (error) {
+    case RowError::FieldCount: return "칸이 4개보다 적음 (직원 코드, 날짜, 출근, 퇴근)";
+    case RowError::Date: return "날짜를 읽을 수 없음 (yyyy-MM-dd)";
+    case RowError::DateRange: return "지원하지 않는 날짜 (1900-01-01 ~ 2199-12-31)";
+    case RowError::StartTime: return "출근 시각을 읽을 수 없음 (HH:mm)";
+    case RowError::EndTime: return "퇴근 시각을 읽을 수 없음 (HH:mm)";
+    case RowError::ZeroLength: return "출근과 퇴근 시각이 같음";
+    case RowError::None: break;
+    }
+    return QString();
+}
+
+// 직원 한 명의 이미 있는(또는 이번에 받아들인) 근무
+// exact: 날짜와 출퇴근 분을 묶은 키 (완전히 같은 근무 찾기)
+// intervalsByDay: 시작 날짜별 [시작, 끝) 구간 (자정부터가 아니라 율리우스 일 기준 절대 분)
+struct EmployeeShifts {
+    QSet<quint64> exact;
+    QHash<qint32, QVector<QPair<qint64, qint64>>> intervalsByDay;
+};
+
+quint64 shiftKey(qint32 day, qint16 startMinute, qint16 endMinute)
+{
+    return (quint64(quint32(day)) << 22) | (quint64(startMinute) << 11) | quint64(endMinute);
+}
+
+QPair<qint64, qint64> shiftInterval(qint32 day, qint16 startMinute, qint16 endMinute)
+{
+    const qint64 begin = qint64(day) * kMinutesPerDay + startMinute;
+    int length = endMinute - startMinute;
+    if (length < 0) length += kMinutesPerDay; // 다음 날 퇴근
+    return qMakePair(begin, begin + length);
+}
+
+void addShift(EmployeeShifts *shifts, qint32 day, qint16 startMinute, qint16 endMinute)
+{
+    shifts->exact.insert(shiftKey(day, startMinute, endMinute));
+    if (startMinute != endMinute) {
+        shifts->intervalsByDay[day].append(shiftInterval(day, startMinute, endMinute));
+    }
+}
+
+// 근무는 하루를 넘지 않으므로 앞뒤 하루에 시작한 근무만 보면 됨
+bool overlapsShift(const EmployeeShifts &shifts, qint32 day, qint16 startMinute, qint16 endMinute)
+{
+    const QPair<qint64, qint64> interval = shiftInterval(day, startMinute, endMinute);
+    for (qint32 other = day - 1; other <= day + 1; ++other) {
+        auto it = shifts.intervalsByDay.constFind(other);
+        if (it == shifts.intervalsByDay.constEnd()) continue;
+        for (const auto &existing : it.value()) {
+            if (interval.first < existing.second && existing.first < interval.second) return true;
+        }
+    }
+    return false;
+}
+}
+
+TimeclockImporter::TimeclockImporter(DataManager *dataManager)
+    : m_dataManager(dataManager)
+{
+}
+
+void TimeclockImporter::setEmployeeCodes(const QHash<QString, int> &employeeIdByCode)
+{
+    m_employeeIdByCode = employeeIdByCode;
+}
+
+bool TimeclockImporter::readFile(const QString &filename)
+{
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(lcImport) << "Couldn't open timeclock file" << filename << ":" << file.errorString();
+        return false;
+    }
+
+    // 메모리 매핑이 되면 복사 없이 파싱하고, 안 되면 통째로 읽음
+    const qint64 size = file.size();
+    if (size > 0) {
+        if (const uchar *mapped = file.map(0, size)) {
+            parse(reinterpret_cast<const char *>(mapped), size);
+            return true;
+        }
+    }
+    const QByteArray data = file.readAll();
+    parse(data.constData(), data.size());
+    return true;
+}
+
+void TimeclockImporter::readData(const QByteArray &data)
+{
+    parse(data.constData(), data.size());
+}
+
+const QList<WorkLog> &TimeclockImporter::workLogs() const
+{
+    return m_workLogs;
+}
+
+const TimeclockImporter::Statistics &TimeclockImporter::statistics() const
+{
+    return m_statistics;
+}
+
+const QStringList &TimeclockImporter::problems() const
+{
+    return m_problems;
+}
+
+int TimeclockImporter::commit()
+{
+    if (!m_dataManager || m_workLogs.isEmpty()) return 0;
+    const int added = m_dataManager->addWorkLogs(m_workLogs);
+    m_workLogs.clear();
+    return added;
+}
+
+// 직원 이름 → ID, 직원 ID 숫자 → ID, setEmployeeCodes 표 순으로 덮어씀
+// 같은 이름의 직원이 여럿이면 그 이름으로는 찾지 않음
+QHash<QByteArray, int> TimeclockImporter::employeeIdsByCode() const
+{
+    QHash<QByteArray, int> idByCode;
+    if (m_dataManager) {
+        QSet<QByteArray> ambiguousNames;
+        const QList<Employee> &employees = m_dataManager->getEmployees();
+        for (const Employee &emp : employees) {
+            const QByteArray name = emp.getName().trimmed().toUtf8();
+            if (name.isEmpty() || ambiguousNames.contains(name)) continue;
+            if (idByCode.contains(name)) {
+                idByCode.remove(name);
+                ambiguousNames.insert(name);
+                continue;
+            }
+            idByCode.insert(name, emp.getId());
+        }
+        for (const Employee &emp : employees) {
+            idByCode.insert(QByteArray::number(emp.getId()), emp.getId());
+        }
+    }
+    for (auto it = m_employeeIdByCode.constBegin(); it != m_employeeIdByCode.constEnd(); ++it) {
+        idByCode.insert(it.key().trimmed().toUtf8(), it.value());
+    }
+    return idByCode;
+}
+
+void TimeclockImporter::addProblem(int line, const QString &message)
+{
+    if (m_problems.size() < kMaxProblems) {
+        m_problems.append(QString("%1행: %2").arg(line).arg(message));
+    }
+}
+
+// 1단계(병렬): 줄 경계로 나눈 청크마다 칸을 나누고 날짜/시각을 숫자로 바꿈
+// 2단계(순차): 파일 순서대로 직원 코드를 ID로 바꾸고, 직원별 해시 집합으로 중복/겹침을 걸러 냄
+void TimeclockImporter::parse(const char *data, qint64 size)
+{
+    m_workLogs.clear();
+    m_problems.clear();
+    m_statistics = Statistics();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QList<Chunk> chunks;
+    {
+        TRACE_SCOPE("TimeclockImporter::parse");
+        qint64 begin = 0;
+        if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+            begin = 3; // UTF-8 BOM
+        }
+
+        const int idealThreads = QThread::idealThreadCount();
+        const int chunkCount = (size - begin >= kParallelParseMinBytes && idealThreads > 1) ? idealThreads * 4 : 1;
+        qint64 chunkBegin = begin;
+        for (int i = 1; i <= chunkCount && chunkBegin < size; ++i) {
+            qint64 chunkEnd = (i == chunkCount) ? size : qMax(chunkBegin, begin + (size - begin) * i / chunkCount);
+            if (chunkEnd < size) {
+                // 줄 중간에서 끊지 않도록 다음 줄바꿈 뒤로 옮김
+                const char *newline = static_cast<const char *>(std::memchr(data + chunkEnd, '\n', size_t(size - chunkEnd)));
+                chunkEnd = newline ? (newline - data) + 1 : size;
+            }
+            Chunk chunk;
+            chunk.begin = chunkBegin;
+            chunk.end = chunkEnd;
+            chunk.isFirst = chunks.isEmpty();
+            chunks.append(chunk);
+            chunkBegin = chunkEnd;
+        }
+
+        if (chunks.size() > 1) {
+            QtConcurrent::blockingMap(chunks, [data](Chunk &chunk) { parseChunk(data, chunk); });
+        } else if (!chunks.isEmpty()) {
+            parseChunk(data, chunks.first());
+        }
+        m_statistics.chunkCount = chunks.size();
+        m_statistics.parseMs = timer.restart();
+    }
+
+    TRACE_SCOPE("TimeclockImporter::check");
+
+    // 직원 코드를 ID로 바꾸고 형식 오류를 모음 (청크 결과는 합친 뒤 바로 해제)
+    struct Candidate {
+        int line;
+        int employeeId;
+        qint32 day;
+        qint16 startMinute;
+        qint16 endMinute;
+    };
+    QVector<Candidate> candidates;
+    QHash<int, QPair<qint32, qint32>> dayRangeByEmployee;
+    const QHash<QByteArray, int> idByCode = employeeIdsByCode();
+    int firstLine = 1;
+    for (Chunk &chunk : chunks) {
+        for (const ParsedRow &row : std::as_const(chunk.rows)) {
+            const int line = firstLine + row.line;
+            ++m_statistics.rowCount;
+            if (row.error != RowError::None) {
+                ++m_statistics.invalidCount;
+                addProblem(line, rowErrorText(row.error));
+                continue;
+            }
+            auto idIt = idByCode.constFind(row.code);
+            if (idIt == idByCode.constEnd()) {
+                ++m_statistics.unknownEmployeeCount;
+                addProblem(line, QString("알 수 없는 직원 코드 '%1'").arg(QString::fromUtf8(row.code)));
+                continue;
+            }
+            candidates.append(Candidate{line, idIt.value(), row.day, row.startMinute, row.endMinute});
+
+            auto rangeIt = dayRangeByEmployee.find(idIt.value());
+            if (rangeIt == dayRangeByEmployee.end()) {
+                dayRangeByEmployee.insert(idIt.value(), qMakePair(row.day, row.day));
+            } else {
+                rangeIt->first = qMin(rangeIt->first, row.day);
+                rangeIt->second = qMax(rangeIt->second, row.day);
+            }
+        }
+        firstLine += chunk.lineCount;
+        chunk.rows.clear();
+    }
+
+    // 가져올 기간(앞뒤 하루 포함, 자정을 넘긴 근무가 걸칠 수 있으므로)의 기존 근무만 집합에 넣음
+    QHash<int, EmployeeShifts> shiftsByEmployee;
+    for (auto it = dayRangeByEmployee.constBegin(); it != dayRangeByEmployee.constEnd(); ++it) {
+        EmployeeShifts &shifts = shiftsByEmployee[it.key()];
+        if (!m_dataManager) continue;
+        const QList<WorkLog> existing = m_dataManager->getWorkLogsForEmployeeInRange(
+            it.key(), WorkLogColumns::decodeDate(it.value().first - 1), WorkLogColumns::decodeDate(it.value().second + 1));
+        for (const WorkLog &log : existing) {
+            if (!log.getStartTime().isValid() || !log.getEndTime().isValid()) continue;
+            addShift(&shifts, WorkLogColumns::encodeDate(log.getDate()),
+                     WorkLogColumns::encodeTime(log.getStartTime()), WorkLogColumns::encodeTime(log.getEndTime()));
+        }
+    }
+
+    // 파일 순서대로 검사하며 받아들인 근무도 집합에 넣음 (파일 안의 중복/겹침도 걸러짐)
+    m_workLogs.reserve(candidates.size());
+    for (const Candidate &candidate : std::as_const(candidates)) {
+        EmployeeShifts &shifts = shiftsByEmployee[candidate.employeeId];
+        if (shifts.exact.contains(shiftKey(candidate.day, candidate.startMinute, candidate.endMinute))) {
+            ++m_statistics.duplicateCount;
+            addProblem(candidate.line, "이미 있는 근무와 같음");
+            continue;
+        }
+        if (overlapsShift(shifts, candidate.day, candidate.startMinute, candidate.endMinute)) {
+            ++m_statistics.overlapCount;
+            addProblem(candidate.line, "같은 직원의 다른 근무와 시간이 겹침");
+            continue;
+        }
+        addShift(&shifts, candidate.day, candidate.startMinute, candidate.endMinute);
+        m_workLogs.append(WorkLog(candidate.employeeId, WorkLogColumns::decodeDate(candidate.day),
+                                  WorkLogColumns::decodeTime(candidate.startMinute),
+                                  WorkLogColumns::decodeTime(candidate.endMinute)));
+    }
+    m_statistics.acceptedCount = m_workLogs.size();
+    m_statistics.checkMs = timer.elapsed();
+
+    qCInfo(lcImport) << "Timeclock rows:" << m_statistics.rowCount << "accepted:" << m_statistics.acceptedCount
+                     << "invalid:" << m_statistics.invalidCount << "unknown employee:" << m_statistics.unknownEmployeeCount
+                     << "duplicate:" << m_statistics.duplicateCount << "overlap:" << m_statistics.overlapCount;
+    qCDebug(lcImport) << "Timeclock timings (ms): chunks" << m_statistics.chunkCount
+                      << "parse" << m_statistics.parseMs << "check" << m_statistics.checkMs;
+}
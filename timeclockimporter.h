@@ -0,0 +1,67 @@
+#ifndef TIMECLOCKIMPORTER_H
+#define TIMECLOCKIMPORTER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include "worklog.h"
+
+class DataManager;
+
+// 출퇴근 기록기에서 내보낸 CSV를 근무 기록으로 한꺼번에 가져오는 클래스
+// 한 줄에 "직원 코드,날짜,출근 시각,퇴근 시각" (예: E0012,2024-05-03,09:00,18:30, 뒤에 칸이 더 있으면 무시)
+// - 첫 줄의 날짜 칸이 날짜가 아니면 머리글로 보고 건너뜀
+// - 날짜는 yyyy-MM-dd 또는 yyyy/MM/dd (1900-01-01 ~ 2199-12-31), 시각은 H:mm 또는 H:mm:ss (초는 버림, 퇴근이 출근보다 이르면 다음 날 퇴근)
+// - 직원 코드는 setEmployeeCodes로 준 표를 먼저 보고, 없으면 직원 ID나 이름이 정확히 같은 직원으로 찾음
+// 큰 파일은 줄 경계에서 나눠 여러 스레드에서 파싱함
+// 기존 기록이나 앞선 줄과 완전히 같은 근무는 중복으로, 같은 직원의 다른 근무와 시간이 겹치면 겹침으로 걸러 냄
+// 읽기만으로는 DataManager가 바뀌지 않고, commit()에서 DataManager::addWorkLogs로 한 번에 추가됨
+class TimeclockImporter
+{
+public:
+    struct Statistics {
+        int rowCount = 0;             // 머리글과 빈 줄을 뺀 데이터 줄 수
+        int acceptedCount = 0;        // 추가할 근무 기록 수
+        int invalidCount = 0;         // 칸 수, 날짜, 시각 형식 오류와 지원 기간 밖의 날짜
+        int unknownEmployeeCount = 0; // 직원 코드를 찾지 못함
+        int duplicateCount = 0;       // 기존 기록이나 앞선 줄과 완전히 같음
+        int overlapCount = 0;         // 같은 직원의 다른 근무와 시간이 겹침
+        int chunkCount = 0;           // 파싱에 쓴 청크 수
+        qint64 parseMs = 0;           // 청크 파싱 (병렬)
+        qint64 checkMs = 0;           // 직원 코드 변환과 중복/겹침 검사
+    };
+
+    explicit TimeclockImporter(DataManager *dataManager);
+
+    // 외부 직원 코드 → 직원 ID 표 (기본 규칙보다 우선)
+    void setEmployeeCodes(const QHash<QString, int> &employeeIdByCode);
+
+    // 파일을 읽고 검사까지 마침 (파일을 열 수 없으면 false)
+    bool readFile(const QString &filename);
+    // 메모리의 CSV 내용을 읽고 검사까지 마침
+    void readData(const QByteArray &data);
+
+    const QList<WorkLog> &workLogs() const; // 추가될 근무 기록 (파일 순서)
+    const Statistics &statistics() const;
+    // 걸러 낸 줄의 설명 ("12행: ..."), 처음 kMaxProblems개만 보관
+    const QStringList &problems() const;
+    static const int kMaxProblems = 100;
+
+    // 준비된 근무 기록을 한 번에 추가하고 추가한 건수를 반환 (이후 workLogs()는 비워짐)
+    int commit();
+
+private:
+    void parse(const char *data, qint64 size);
+    QHash<QByteArray, int> employeeIdsByCode() const; // 기본 규칙과 setEmployeeCodes를 합친 표
+    void addProblem(int line, const QString &message);
+
+    DataManager *m_dataManager;
+    QHash<QString, int> m_employeeIdByCode;
+    QList<WorkLog> m_workLogs;
+    Statistics m_statistics;
+    QStringList m_problems;
+};
+
+#endif // TIMECLOCKIMPORTER_H
@@ -0,0 +1,210 @@
+#include "tracing.h"
+#include "logging.h"
+#include <QCoreApplication>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QThread>
+#include <QList>
+#include <QDebug>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace Tracing {
+
+namespace detail {
+std::atomic<bool> g_enabled(false);
+}
+
+namespace {
+struct Event {
+    const char *name;
+    qint64 startNs;
+    qint64 endNs;
+};
+
+// 스레드 하나가 채우는 고정 크기 블록. 쓰는 쪽은 그 스레드뿐이고,
+// count와 next를 release로 내보내므로 내보내기 쪽은 잠금 없이 이미 기록된 부분만 읽음
+const int kBlockSize = 4096;
+struct Block {
+    Event events[kBlockSize];
+    std::atomic<int> count{0};
+    std::atomic<Block *> next{nullptr};
+};
+
+struct ThreadBuffer {
+    int threadIndex = 0;
+    QString threadName;
+    Block *head = nullptr;
+    Block *tail = nullptr; // 소유 스레드만 접근
+};
+
+// 스레드 등록과 내보내기에서만 잠금 (기록 경로에는 없음)
+QMutex s_registryMutex;
+QList<ThreadBuffer *> s_buffers;
+QString s_outputPath;
+const std::chrono::steady_clock::time_point s_epoch = std::chrono::steady_clock::now();
+
+ThreadBuffer *registerCurrentThread()
+{
+    ThreadBuffer *buffer = new ThreadBuffer; // 내보내기가 끝난 스레드의 기록도 읽어야 하므로 해제하지 않음
+    buffer->head = buffer->tail = new Block;
+
+    QThread *thread = QThread::currentThread();
+    QMutexLocker locker(&s_registryMutex);
+    buffer->threadIndex = s_buffers.size() + 1;
+    if (QCoreApplication::instance() && thread == QCoreApplication::instance()->thread()) {
+        buffer->threadName = "main";
+    } else if (thread && !thread->objectName().isEmpty()) {
+        buffer->threadName = QString("%1 %2").arg(thread->objectName()).arg(buffer->threadIndex);
+    } else {
+        buffer->threadName = QString("thread %1").arg(buffer->threadIndex);
+    }
+    s_buffers.append(buffer);
+    return buffer;
+}
+
+ThreadBuffer *currentThreadBuffer()
+{
+    thread_local ThreadBuffer *buffer = registerCurrentThread();
+    return buffer;
+}
+
+// 이름은 코드에 적은 리터럴이지만 혹시 모를 따옴표/역슬래시는 이스케이프
+QByteArray jsonString(const QByteArray &text)
+{
+    QByteArray escaped;
+    escaped.reserve(text.size() + 2);
+    escaped += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        if (static_cast<unsigned char>(c) < 0x20) continue;
+        escaped += c;
+    }
+    escaped += '"';
+    return escaped;
+}
+}
+
+namespace detail {
+qint64 nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+void record(const char *name, qint64 startNs, qint64 endNs)
+{
+    ThreadBuffer *buffer = currentThreadBuffer();
+    Block *block = buffer->tail;
+    int count = block->count.load(std::memory_order_relaxed);
+    if (count == kBlockSize) {
+        Block *fresh = new Block;
+        block->next.store(fresh, std::memory_order_release);
+        buffer->tail = block = fresh;
+        count = 0;
+    }
+    block->events[count] = Event{name, startNs, endNs};
+    block->count.store(count + 1, std::memory_order_release);
+}
+}
+
+void setEnabled(bool enabled)
+{
+    detail::g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool initialize(int *argc, char *argv[])
+{
+    QString path = qEnvironmentVariable("CPP_PROJECT_TRACE");
+
+    // --trace <경로> 또는 --trace=<경로>를 찾아 인자 목록에서 뺌
+    int out = 1;
+    for (int i = 1; i < *argc; ++i) {
+        if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < *argc) {
+            path = QString::fromLocal8Bit(argv[++i]);
+        } else if (std::strncmp(argv[i], "--trace=", 8) == 0) {
+            path = QString::fromLocal8Bit(argv[i] + 8);
+        } else {
+            argv[out++] = argv[i];
+        }
+    }
+    *argc = out;
+    argv[out] = nullptr;
+
+    if (path.isEmpty()) return false;
+    {
+        QMutexLocker locker(&s_registryMutex);
+        s_outputPath = path;
+    }
+    setEnabled(true);
+    return true;
+}
+
+QString outputPath()
+{
+    QMutexLocker locker(&s_registryMutex);
+    return s_outputPath;
+}
+
+bool writeChromeTrace(const QString &filename)
+{
+    QList<ThreadBuffer *> buffers;
+    {
+        QMutexLocker locker(&s_registryMutex);
+        buffers = s_buffers;
+    }
+
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(lcTrace) << "Couldn't open trace file for writing:" << filename;
+        return false;
+    }
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QByteArray chunk = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    qint64 eventCount = 0;
+    for (const ThreadBuffer *buffer : std::as_const(buffers)) {
+        // 스레드 이름 메타데이터
+        chunk += (first ? "" : ",");
+        chunk += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + QByteArray::number(pid)
+                 + ",\"tid\":" + QByteArray::number(buffer->threadIndex)
+                 + ",\"args\":{\"name\":" + jsonString(buffer->threadName.toUtf8()) + "}}";
+        first = false;
+
+        for (const Block *block = buffer->head; block; block = block->next.load(std::memory_order_acquire)) {
+            const int count = block->count.load(std::memory_order_acquire);
+            for (int i = 0; i < count; ++i) {
+                const Event &event = block->events[i];
+                char numbers[160];
+                std::snprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%lld,\"tid\":%d}",
+                              event.startNs / 1000.0, (event.endNs - event.startNs) / 1000.0,
+                              static_cast<long long>(pid), buffer->threadIndex);
+                chunk += ",{\"name\":" + jsonString(event.name) + numbers;
+                ++eventCount;
+            }
+            if (chunk.size() >= (1 << 20)) {
+                file.write(chunk);
+                chunk.clear();
+            }
+        }
+    }
+    chunk += "]}\n";
+    file.write(chunk);
+
+    if (!file.commit()) {
+        qCWarning(lcTrace) << "Failed to write trace file" << filename << ":" << file.errorString();
+        return false;
+    }
+    qCInfo(lcTrace) << "Wrote" << eventCount << "trace events to" << filename;
+    return true;
+}
+
+bool dump()
+{
+    const QString path = outputPath();
+    return !path.isEmpty() && writeChromeTrace(path);
+}
+
+} // namespace Tracing
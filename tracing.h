@@ -0,0 +1,60 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+// 구간(span) 단위 성능 추적
+// TRACE_SCOPE("이름")을 둔 블록이 끝날 때 시작 시각과 걸린 시간을 스레드별 버퍼에 기록하고,
+// 모아 둔 기록은 Chrome trace-event JSON(chrome://tracing, Perfetto에서 열림)으로 내보냄
+//
+// 켜는 방법: 환경 변수 CPP_PROJECT_TRACE=<파일 경로> 또는 실행 인자 --trace <파일 경로>
+// 꺼져 있으면 TRACE_SCOPE는 원자 변수 하나만 읽고 끝남
+// 기록은 스레드마다 따로 쓰므로 잠금이 없고, 버퍼 블록은 프로그램이 끝날 때까지 해제하지 않음
+namespace Tracing {
+
+namespace detail {
+extern std::atomic<bool> g_enabled;
+qint64 nowNs();
+void record(const char *name, qint64 startNs, qint64 endNs);
+}
+
+inline bool isEnabled() { return detail::g_enabled.load(std::memory_order_relaxed); }
+void setEnabled(bool enabled);
+
+// 환경 변수와 실행 인자를 확인해 추적을 켬 (켜지면 true). 인자에서 --trace와 경로는 제거됨
+bool initialize(int *argc, char *argv[]);
+// initialize로 정한 출력 경로 (꺼져 있으면 빈 문자열)
+QString outputPath();
+
+// 지금까지의 기록을 Chrome trace-event JSON으로 씀 (기록은 지우지 않으므로 여러 번 호출해도 됨)
+bool writeChromeTrace(const QString &filename);
+// outputPath()가 있으면 그 경로로 씀
+bool dump();
+
+// 블록 범위의 구간 하나. name은 프로그램이 끝날 때까지 유효한 문자열(리터럴)이어야 함
+class Span
+{
+public:
+    explicit Span(const char *name)
+        : m_name(isEnabled() ? name : nullptr), m_startNs(m_name ? detail::nowNs() : 0) {}
+    ~Span()
+    {
+        if (m_name) detail::record(m_name, m_startNs, detail::nowNs());
+    }
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+
+private:
+    const char *m_name;
+    qint64 m_startNs;
+};
+
+} // namespace Tracing
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) Tracing::Span TRACE_CONCAT(traceSpan_, __LINE__)(name)
+
+#endif // TRACING_H
@@ -0,0 +1,560 @@
+// 핵심 라이브러리(cpp_project_core) 단위 시험
+// 데이터는 벤치마크의 "small" 규모(직원 10명 × 1년 × 주 5회)를 기본으로 하고,
+// 병렬 JSON 불러오기처럼 파일 크기 기준이 있는 경우만 더 크게 만듦
+#include <QtTest>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMap>
+#include <QTemporaryDir>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "binarysnapshot.h"
+#include "datajournal.h"
+#include "datamanager.h"
+#include "payrollengine.h"
+#include "timeclockimporter.h"
+#include "worktimekernels.h"
+
+namespace {
+const QDate kFirstDay(2020, 1, 6); // 월요일
+const int kSmallEmployeeCount = 10;
+const int kSmallYears = 1;
+
+// 직원마다 월~금에 하루 한 번씩 근무 (늦게 시작하면 자정을 넘김, 주말은 비워 둠)
+// 예전 화면 계산은 하루에 첫 근무 기록만 주휴수당에 넣었으므로 비교용 데이터는 하루 한 건으로 만듦
+QList<WorkLog> generateShifts(const QList<int> &employeeIds, int years)
+{
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> startDist(6 * 60, 20 * 60);
+    std::uniform_int_distribution<int> lengthDist(3 * 60, 9 * 60);
+
+    QList<WorkLog> shifts;
+    const int weeks = years * 52;
+    for (int employeeId : employeeIds) {
+        for (int week = 0; week < weeks; ++week) {
+            for (int weekday = 0; weekday < 5; ++weekday) {
+                const QDate date = kFirstDay.addDays(week * 7 + weekday);
+                const int start = startDist(rng);
+                const int end = (start + lengthDist(rng)) % (24 * 60);
+                shifts.append(WorkLog(employeeId, date, QTime(start / 60, start % 60), QTime(end / 60, end % 60)));
+            }
+        }
+    }
+    return shifts;
+}
+
+void populate(DataManager &dataManager, int employeeCount, int years, QList<int> *employeeIds, QList<WorkLog> *shifts)
+{
+    employeeIds->clear();
+    for (int i = 0; i < employeeCount; ++i) {
+        Employee emp(-1, QString("직원%1").arg(i + 1), 10000 + (i % 10) * 370, QString("000-%1").arg(i, 6, 10, QChar('0')));
+        dataManager.addEmployee(emp);
+        employeeIds->append(emp.getId());
+    }
+    *shifts = generateShifts(*employeeIds, years);
+    dataManager.addWorkLogs(*shifts);
+}
+
+// 두 목록이 같으면 빈 문자열, 다르면 처음 다른 곳의 설명
+QString compareWorkLogs(const QList<WorkLog> &actual, const QList<WorkLog> &expected)
+{
+    if (actual.size() != expected.size()) {
+        return QString("worklog count %1, expected %2").arg(actual.size()).arg(expected.size());
+    }
+    for (int i = 0; i < actual.size(); ++i) {
+        const WorkLog &a = actual.at(i);
+        const WorkLog &e = expected.at(i);
+        if (a.getEmployeeId() != e.getEmployeeId() || a.getDate() != e.getDate()
+            || a.getStartTime() != e.getStartTime() || a.getEndTime() != e.getEndTime()) {
+            return QString("worklog %1: (%2, %3, %4-%5), expected (%6, %7, %8-%9)")
+                .arg(i)
+                .arg(a.getEmployeeId()).arg(a.getDate().toString(Qt::ISODate))
+                .arg(a.getStartTime().toString("HH:mm:ss"), a.getEndTime().toString("HH:mm:ss"))
+                .arg(e.getEmployeeId()).arg(e.getDate().toString(Qt::ISODate))
+                .arg(e.getStartTime().toString("HH:mm:ss"), e.getEndTime().toString("HH:mm:ss"));
+        }
+    }
+    return QString();
+}
+
+QString compareEmployees(const QList<Employee> &actual, const QList<Employee> &expected)
+{
+    if (actual.size() != expected.size()) {
+        return QString("employee count %1, expected %2").arg(actual.size()).arg(expected.size());
+    }
+    for (int i = 0; i < actual.size(); ++i) {
+        if (actual.at(i).toJson() != expected.at(i).toJson()) {
+            return QString("employee %1 (ID %2) differs").arg(i).arg(expected.at(i).getId());
+        }
+    }
+    return QString();
+}
+
+// DataManager::getWorkLogs()와 같은 순서 (직원 ID, 날짜, 같은 날짜는 입력 순서)
+void sortLikeDataManager(QList<WorkLog> *logs)
+{
+    std::stable_sort(logs->begin(), logs->end(), [](const WorkLog &a, const WorkLog &b) {
+        if (a.getEmployeeId() != b.getEmployeeId()) return a.getEmployeeId() < b.getEmployeeId();
+        return a.getDate() < b.getDate();
+    });
+}
+
+// 정수 급여 계산 이전 InfoDisplayWidget의 계산 (시간을 double로 누적, 주휴수당은 시급 * 0.2 * 주 시간)
+struct WidgetPayroll {
+    double hours = 0.0;
+    double basicPay = 0.0;
+    double weeklyHoliday = 0.0;
+    double tax = 0.0;
+    double totalPay = 0.0;
+};
+
+double widgetHoursWorked(const WorkLog &log)
+{
+    if (!log.getStartTime().isValid() || !log.getEndTime().isValid()) return 0.0;
+    int seconds = log.getStartTime().secsTo(log.getEndTime());
+    if (seconds < 0) seconds += 24 * 60 * 60;
+    return static_cast<double>(seconds) / 3600.0;
+}
+
+WidgetPayroll widgetPayroll(const QList<WorkLog> &logs, int employeeId, int hourlyWage,
+                            const QDate &startDate, const QDate &endDate)
+{
+    WidgetPayroll payroll;
+    QMap<QDate, double> weeklyHours;
+    for (const WorkLog &log : logs) {
+        if (log.getEmployeeId() != employeeId || log.getDate() < startDate || log.getDate() > endDate) continue;
+        payroll.hours += widgetHoursWorked(log);
+        weeklyHours[log.getDate().addDays(1 - log.getDate().dayOfWeek())] += widgetHoursWorked(log);
+    }
+    payroll.basicPay = payroll.hours * hourlyWage;
+    for (auto it = weeklyHours.constBegin(); it != weeklyHours.constEnd(); ++it) {
+        if (it.value() >= 15.0 - 1e-9) { // 초를 3600으로 나눠 더한 오차로 딱 15시간인 주가 빠지지 않게
+            payroll.weeklyHoliday += hourlyWage * 0.2 * it.value();
+        }
+    }
+    payroll.tax = (payroll.basicPay + payroll.weeklyHoliday) * 0.033;
+    payroll.totalPay = payroll.basicPay + payroll.weeklyHoliday - payroll.tax;
+    return payroll;
+}
+
+// 예전 계산의 원 미만 절사 (부동소수점 오차로 정수 금액이 1원 모자라게 잘리지 않도록 아주 작은 값을 더함)
+qint64 floorWon(double amount)
+{
+    return static_cast<qint64>(std::floor(amount + 1e-6));
+}
+}
+
+class CoreTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void journalReplay();
+    void journalCompactionAcrossSessions();
+    void binarySnapshotRoundTrip();
+    void jsonStreamingMatchesDom_data();
+    void jsonStreamingMatchesDom();
+    void payrollMatchesWidgetMath_data();
+    void payrollMatchesWidgetMath();
+    void timeclockImportRules();
+    void kernelLevelsMatchScalar();
+};
+
+// 저장소에 기록한 변경을 저널만으로 다시 열었을 때 같은 상태가 되는지
+void CoreTest::journalReplay()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString storePath = dir.filePath("store.dat");
+
+    QList<int> employeeIds;
+    QList<WorkLog> expectedLogs;
+    QList<Employee> expectedEmployees;
+    QHash<int, qint64> expectedMinutes;
+    const QDate lastDay = kFirstDay.addDays(kSmallYears * 52 * 7 - 1);
+    {
+        DataManager writer;
+        writer.openStore(storePath); // 스냅샷이 아직 없으므로 빈 상태에서 저널만 쌓임
+        QList<WorkLog> shifts;
+        populate(writer, kSmallEmployeeCount, kSmallYears, &employeeIds, &shifts);
+
+        // 건별 변경: 추가(토요일), 날짜를 옮기는 수정, 삭제, 직원 수정/삭제
+        QVERIFY(writer.addWorkLog(WorkLog(employeeIds.at(0), kFirstDay.addDays(5), QTime(10, 0), QTime(14, 30))));
+        const WorkLog oldLog = writer.getWorkLogByEmployeeAndDate(employeeIds.at(1), kFirstDay.addDays(7));
+        QVERIFY(oldLog.getEmployeeId() == employeeIds.at(1));
+        QVERIFY(writer.updateWorkLog(oldLog, WorkLog(employeeIds.at(1), kFirstDay.addDays(12), QTime(8, 0), QTime(12, 0))));
+        QVERIFY(writer.deleteWorkLog(employeeIds.at(2), kFirstDay.addDays(14)));
+        Employee changed = writer.getEmployeeById(employeeIds.at(3));
+        changed.setHourlyWage(12345);
+        changed.setName("이름 변경");
+        QVERIFY(writer.updateEmployeeById(employeeIds.at(3), changed));
+        QVERIFY(writer.deleteEmployeeById(employeeIds.at(4)));
+
+        expectedLogs = writer.getWorkLogs();
+        expectedEmployees = writer.getEmployees();
+        for (int employeeId : std::as_const(employeeIds)) {
+            expectedMinutes.insert(employeeId, writer.getTotalMinutesForEmployee(employeeId, kFirstDay, lastDay));
+        }
+        writer.closeStore();
+    }
+    QVERIFY(QFile::exists(DataJournal::journalPathFor(storePath)));
+
+    DataManager reader;
+    QVERIFY(reader.openStore(storePath, DataManager::ReadOnly));
+    const QString logDifference = compareWorkLogs(reader.getWorkLogs(), expectedLogs);
+    QVERIFY2(logDifference.isEmpty(), qPrintable(logDifference));
+    const QString employeeDifference = compareEmployees(reader.getEmployees(), expectedEmployees);
+    QVERIFY2(employeeDifference.isEmpty(), qPrintable(employeeDifference));
+    for (int employeeId : std::as_const(employeeIds)) {
+        QCOMPARE(reader.getTotalMinutesForEmployee(employeeId, kFirstDay, lastDay), expectedMinutes.value(employeeId));
+    }
+}
+
+// 짧은 실행이 반복돼도 이전 실행에서 쌓인 저널 레코드가 압축 기준에 들어가 스냅샷이 써지는지
+void CoreTest::journalCompactionAcrossSessions()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString storePath = dir.filePath("store.dat");
+    const int firstSessionLogs = DataManager::kJournalCompactionThreshold - 100;
+    const int secondSessionLogs = 200;
+    auto shiftOn = [](int employeeId, int dayOffset) {
+        return WorkLog(employeeId, kFirstDay.addDays(dayOffset), QTime(9, 0), QTime(18, 0));
+    };
+
+    int employeeId = -1;
+    {
+        DataManager first;
+        first.openStore(storePath);
+        Employee emp(-1, "직원", 10000, "000-000000");
+        first.addEmployee(emp);
+        employeeId = emp.getId();
+        for (int i = 0; i < firstSessionLogs; ++i) {
+            QVERIFY(first.addWorkLog(shiftOn(employeeId, i)));
+        }
+        first.closeStore();
+    }
+    QVERIFY(!QFile::exists(storePath)); // 아직 기준 미만이라 저널만 있음
+    const int firstSessionRecords = firstSessionLogs + 1; // 직원 추가 레코드 포함
+
+    QList<WorkLog> expectedLogs;
+    {
+        DataManager second;
+        QVERIFY(second.openStore(storePath));
+        QCOMPARE(int(second.getWorkLogs().size()), firstSessionLogs);
+        for (int i = 0; i < secondSessionLogs; ++i) {
+            QVERIFY(second.addWorkLog(shiftOn(employeeId, firstSessionLogs + i)));
+        }
+        expectedLogs = second.getWorkLogs();
+        second.closeStore();
+    }
+    QVERIFY(QFile::exists(storePath));
+    QVERIFY(!QFile::exists(DataJournal::rotatedJournalPathFor(storePath)));
+    // 두 실행을 합쳐 기준에 닿은 순간 회전했으므로 활성 저널에는 그 뒤의 레코드만 남음
+    const int recordsAfterRotation = firstSessionRecords + secondSessionLogs - DataManager::kJournalCompactionThreshold;
+    QCOMPARE(int(DataJournal::readRecords(DataJournal::journalPathFor(storePath)).size()), recordsAfterRotation);
+
+    DataManager reader;
+    QVERIFY(reader.openStore(storePath, DataManager::ReadOnly));
+    const QString logDifference = compareWorkLogs(reader.getWorkLogs(), expectedLogs);
+    QVERIFY2(logDifference.isEmpty(), qPrintable(logDifference));
+}
+
+// 바이너리 스냅샷으로 저장했다 불러오면 근무 기록(시간 없는 기록 포함)과 집계가 그대로인지
+void CoreTest::binarySnapshotRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath("snapshot.dat");
+
+    DataManager source;
+    QList<int> employeeIds;
+    QList<WorkLog> shifts;
+    populate(source, kSmallEmployeeCount, kSmallYears, &employeeIds, &shifts);
+    QVERIFY(source.addWorkLog(WorkLog(employeeIds.at(0), kFirstDay.addDays(6), QTime(), QTime())));
+    QVERIFY(source.saveData(snapshotPath));
+    QVERIFY(BinarySnapshot::isBinarySnapshot(snapshotPath));
+
+    BinarySnapshot::Contents contents;
+    QVERIFY(BinarySnapshot::read(snapshotPath, &contents));
+    QCOMPARE(int(contents.days.size()), int(source.getWorkLogs().size()));
+    QCOMPARE(int(contents.employees.size()), int(source.getEmployees().size()));
+
+    DataManager loaded;
+    QVERIFY(loaded.loadData(snapshotPath));
+    const QString logDifference = compareWorkLogs(loaded.getWorkLogs(), source.getWorkLogs());
+    QVERIFY2(logDifference.isEmpty(), qPrintable(logDifference));
+    const QString employeeDifference = compareEmployees(loaded.getEmployees(), source.getEmployees());
+    QVERIFY2(employeeDifference.isEmpty(), qPrintable(employeeDifference));
+
+    const QDate lastDay = kFirstDay.addDays(kSmallYears * 52 * 7 - 1);
+    for (int employeeId : std::as_const(employeeIds)) {
+        QCOMPARE(loaded.getTotalMinutesForEmployee(employeeId, kFirstDay, lastDay),
+                 source.getTotalMinutesForEmployee(employeeId, kFirstDay, lastDay));
+        QCOMPARE(loaded.getWeeklyMinutesForEmployee(employeeId, kFirstDay, lastDay),
+                 source.getWeeklyMinutesForEmployee(employeeId, kFirstDay, lastDay));
+    }
+
+    // 열 값이 범위를 벗어난 파일은 거부: 지원 기간 밖의 날짜, 1439를 넘는 분 (파일 끝 두 바이트가 마지막 퇴근 분)
+    const QString outOfWindowPath = dir.filePath("outOfWindow.dat");
+    QVERIFY(BinarySnapshot::write(outOfWindowPath, 2, 0, source.getEmployees(),
+                                  {WorkLog(employeeIds.at(0), QDate(1850, 1, 1), QTime(9, 0), QTime(18, 0))}));
+    QVERIFY(!BinarySnapshot::read(outOfWindowPath, &contents));
+    QVERIFY(!loaded.loadData(outOfWindowPath));
+
+    QFile corrupt(snapshotPath);
+    QVERIFY(corrupt.open(QIODevice::ReadWrite));
+    QVERIFY(corrupt.seek(corrupt.size() - 2));
+    const char badMinute[2] = {char(0xD0), char(0x07)}; // 2000 (리틀 엔디언)
+    QCOMPARE(corrupt.write(badMinute, 2), qint64(2));
+    corrupt.close();
+    QVERIFY(!BinarySnapshot::read(snapshotPath, &contents));
+}
+
+void CoreTest::jsonStreamingMatchesDom_data()
+{
+    QTest::addColumn<int>("employeeCount");
+    QTest::addColumn<int>("years");
+    QTest::addColumn<bool>("parallel");
+
+    QTest::newRow("small (streaming)") << kSmallEmployeeCount << kSmallYears << false;
+    // 병렬 경로는 8MB 이상의 파일에서만 쓰이므로 약 7만 8천 건(약 12MB)으로 만듦
+    QTest::newRow("parallel") << 100 << 3 << true;
+}
+
+// 스트리밍/병렬 JSON 불러오기 결과가 QJsonDocument로 통째로 읽은 결과와 같은지
+void CoreTest::jsonStreamingMatchesDom()
+{
+    QFETCH(int, employeeCount);
+    QFETCH(int, years);
+    QFETCH(bool, parallel);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString jsonPath = dir.filePath("snapshot.json");
+    {
+        DataManager source;
+        QList<int> employeeIds;
+        QList<WorkLog> shifts;
+        populate(source, employeeCount, years, &employeeIds, &shifts);
+        QVERIFY(source.saveData(jsonPath));
+    }
+
+    QFile file(jsonPath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    file.close();
+    QList<Employee> domEmployees;
+    const QJsonArray employeeArray = root.value("employees").toArray();
+    for (const QJsonValue &value : employeeArray) {
+        domEmployees.append(Employee::fromJson(value.toObject()));
+    }
+    QList<WorkLog> domLogs;
+    const QJsonArray workLogArray = root.value("worklogs").toArray();
+    for (const QJsonValue &value : workLogArray) {
+        domLogs.append(WorkLog::fromJson(value.toObject()));
+    }
+    sortLikeDataManager(&domLogs);
+
+    DataManager loaded;
+    QVERIFY(loaded.loadData(jsonPath));
+    const QString logDifference = compareWorkLogs(loaded.getWorkLogs(), domLogs);
+    QVERIFY2(logDifference.isEmpty(), qPrintable(logDifference));
+    const QString employeeDifference = compareEmployees(loaded.getEmployees(), domEmployees);
+    QVERIFY2(employeeDifference.isEmpty(), qPrintable(employeeDifference));
+
+    const DataManager::LoadStatistics &stats = loaded.lastLoadStatistics();
+    QCOMPARE(stats.workLogCount, int(domLogs.size()));
+    if (parallel && QThread::idealThreadCount() > 1) {
+        QVERIFY2(stats.threadCount > 1, "file was expected to take the parallel path");
+        QVERIFY(stats.chunkCount > 1);
+    } else if (!parallel) {
+        QCOMPARE(stats.threadCount, 1);
+    }
+}
+
+void CoreTest::payrollMatchesWidgetMath_data()
+{
+    QTest::addColumn<QDate>("startDate");
+    QTest::addColumn<QDate>("endDate");
+
+    QTest::newRow("whole year") << kFirstDay << kFirstDay.addDays(52 * 7 - 1);
+    QTest::newRow("month") << QDate(2020, 3, 1) << QDate(2020, 3, 31);
+    QTest::newRow("partial weeks") << QDate(2020, 2, 5) << QDate(2020, 3, 17); // 수요일 ~ 화요일
+}
+
+// PayrollEngine의 정수 계산이 예전 화면의 double 계산과 원 단위 절사 차이 안에서 같은지
+// 근무분, 근무시간 급여, 주휴수당은 정확히 같고, 세금은 절사 전 금액에 매기던 차이로 1원까지 다를 수 있음
+void CoreTest::payrollMatchesWidgetMath()
+{
+    QFETCH(QDate, startDate);
+    QFETCH(QDate, endDate);
+
+    DataManager dataManager;
+    QList<int> employeeIds;
+    QList<WorkLog> shifts;
+    populate(dataManager, kSmallEmployeeCount, kSmallYears, &employeeIds, &shifts);
+
+    const PayrollResult result = PayrollEngine::compute(dataManager.snapshot(), startDate, endDate, employeeIds);
+    QVERIFY(!result.cancelled);
+    QCOMPARE(int(result.lines.size()), int(employeeIds.size()));
+
+    qint64 netTotal = 0;
+    for (int employeeId : std::as_const(employeeIds)) {
+        const PayrollLine *line = result.line(employeeId);
+        QVERIFY(line);
+        const WidgetPayroll widget = widgetPayroll(shifts, employeeId, line->hourlyWage, startDate, endDate);
+
+        QCOMPARE(line->minutes, qRound64(widget.hours * 60.0));
+        QCOMPARE(line->basicPay, floorWon(widget.basicPay));
+        QCOMPARE(line->weeklyHolidayPay, floorWon(widget.weeklyHoliday));
+        QVERIFY2(qAbs(line->tax - floorWon(widget.tax)) <= 1,
+                 qPrintable(QString("tax %1, widget %2").arg(line->tax).arg(widget.tax, 0, 'f', 2)));
+        QCOMPARE(line->netPay, line->basicPay + line->weeklyHolidayPay - line->tax);
+        QVERIFY2(qAbs(line->netPay - floorWon(widget.totalPay)) <= 2,
+                 qPrintable(QString("net %1, widget %2").arg(line->netPay).arg(widget.totalPay, 0, 'f', 2)));
+        netTotal += line->netPay;
+    }
+    QCOMPARE(result.totals.netPay, netTotal);
+    QCOMPARE(result.totals.employeeCount, int(employeeIds.size()));
+}
+
+// CSV 가져오기의 형식 오류, 직원 코드, 중복(기존/파일 안), 겹침(자정 넘김 포함) 규칙
+void CoreTest::timeclockImportRules()
+{
+    DataManager dataManager;
+    Employee kim(-1, "김철수", 10000, "111");
+    Employee lee(-1, "이영희", 11000, "222");
+    dataManager.addEmployee(kim);
+    dataManager.addEmployee(lee);
+    QVERIFY(dataManager.addWorkLog(WorkLog(kim.getId(), QDate(2024, 5, 3), QTime(9, 0), QTime(18, 0))));
+
+    const QByteArray csv = QByteArray("\xEF\xBB\xBF")
+                           + "직원,날짜,출근,퇴근\r\n"
+                             "김철수,2024-05-03,09:00,18:00\r\n" // 기존 기록과 같음 → 중복
+                             "김철수,2024-05-03,17:00,20:00\n"   // 기존 기록과 겹침
+                             "김철수,2024-05-04,22:00,06:00\n"   // 자정을 넘기는 근무 → 추가
+                             "김철수,2024-05-05,05:00,07:00\n"   // 앞 줄의 다음 날 06:00 퇴근과 겹침
+                             "김철수,2024-05-04,22:00,06:00\n"   // 앞 줄과 같음 → 중복
+                             "\n"
+                             + QByteArray::number(lee.getId()) + ",2024/05/04,9:00:30,18:00\n" // 직원 ID 코드, 초는 버림 → 추가
+                             "이영희,2024-05-04,18:00,20:00\n"   // 앞 근무의 퇴근과 맞닿기만 함 → 추가
+                             "박민수,2024-05-04,09:00,18:00\n"   // 없는 직원
+                             "김철수,2024-13-01,09:00,18:00\n"   // 잘못된 날짜
+                             "김철수,1850-01-01,09:00,18:00\n"   // 지원 기간 밖의 날짜
+                             "김철수,2024-05-06,09:00\n"         // 칸 부족
+                             "김철수,2024-05-06,09:00,09:00\n"   // 출퇴근이 같음
+                             "\"김철수\",2024-05-07,09:00,12:00"; // 따옴표 칸, 마지막 줄 줄바꿈 없음 → 추가
+
+    TimeclockImporter importer(&dataManager);
+    importer.readData(csv);
+    const TimeclockImporter::Statistics &stats = importer.statistics();
+    QCOMPARE(stats.rowCount, 13);
+    QCOMPARE(stats.acceptedCount, 4);
+    QCOMPARE(stats.duplicateCount, 2);
+    QCOMPARE(stats.overlapCount, 2);
+    QCOMPARE(stats.unknownEmployeeCount, 1);
+    QCOMPARE(stats.invalidCount, 4);
+    QCOMPARE(int(importer.problems().size()), 9);
+    // 형식 오류와 없는 직원은 첫 단계에서, 중복과 겹침은 다음 단계에서 모이므로 처음 문제는 10행
+    QVERIFY(importer.problems().first().startsWith("10행:"));
+
+    const QList<WorkLog> &accepted = importer.workLogs();
+    QCOMPARE(int(accepted.size()), 4);
+    QCOMPARE(accepted.at(0).getEmployeeId(), kim.getId());
+    QCOMPARE(accepted.at(0).getDate(), QDate(2024, 5, 4));
+    QCOMPARE(accepted.at(0).getMinutesWorked(), 8 * 60);
+    QCOMPARE(accepted.at(1).getEmployeeId(), lee.getId());
+    QCOMPARE(accepted.at(1).getStartTime(), QTime(9, 0));
+
+    QCOMPARE(importer.commit(), 4);
+    QVERIFY(importer.workLogs().isEmpty());
+    QCOMPARE(int(dataManager.getWorkLogsForEmployeeInRange(kim.getId(), QDate(2024, 5, 1), QDate(2024, 5, 31)).size()), 3);
+    QCOMPARE(int(dataManager.getWorkLogsForEmployeeInRange(lee.getId(), QDate(2024, 5, 1), QDate(2024, 5, 31)).size()), 2);
+
+    // 같은 파일을 다시 가져오면 앞에서 추가된 근무는 모두 기존 기록과 같은 중복
+    TimeclockImporter again(&dataManager);
+    again.readData(csv);
+    QCOMPARE(again.statistics().acceptedCount, 0);
+    QCOMPARE(again.statistics().duplicateCount, 6);
+    QCOMPARE(again.statistics().overlapCount, 2);
+}
+
+// 집계 커널의 SSE4.2/AVX2 구현이 스칼라 구현과 같은 값을 내는지 (CPU가 지원하는 수준만 검사)
+// 무효 날짜/시간, 자정 넘김, 벡터 폭으로 나누어떨어지지 않는 길이를 섞어서 확인
+void CoreTest::kernelLevelsMatchScalar()
+{
+    const WorkTimeKernels::Level originalLevel = WorkTimeKernels::activeLevel();
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> minuteDist(-1, 24 * 60 - 1);
+    std::uniform_int_distribution<int> dayDist(-3, 60);
+    std::uniform_int_distribution<qint64> dailyDist(0, 24 * 60);
+    const qint32 baseDay = qint32(kFirstDay.toJulianDay());
+
+    for (int count : {0, 1, 7, 8, 15, 16, 17, 33, 100, 1000}) {
+        QVector<qint32> days(count);
+        QVector<qint16> startMinutes(count);
+        QVector<qint16> endMinutes(count);
+        QVector<qint64> daily(count);
+        for (int i = 0; i < count; ++i) {
+            const int offset = dayDist(rng);
+            days[i] = offset < 0 ? WorkLogColumns::kInvalidDay : baseDay + offset;
+            startMinutes[i] = qint16(minuteDist(rng));
+            endMinutes[i] = qint16(minuteDist(rng));
+            daily[i] = dailyDist(rng);
+        }
+        const qint32 fromDay = baseDay + 10;
+        const qint32 toDay = baseDay + 40;
+
+        WorkTimeKernels::setLevel(WorkTimeKernels::Scalar);
+        QVector<qint16> expectedMinutes(count);
+        WorkTimeKernels::shiftMinutes(startMinutes.constData(), endMinutes.constData(), expectedMinutes.data(), count);
+        QVector<qint64> expectedWeekly((count + 6) / 7);
+        WorkTimeKernels::weeklyTotals(daily.constData(), count, expectedWeekly.data());
+        const qint64 expectedSum = WorkTimeKernels::sumMinutesInDayRange(days.constData(), startMinutes.constData(),
+                                                                         endMinutes.constData(), count, fromDay, toDay);
+
+        for (WorkTimeKernels::Level level : {WorkTimeKernels::Sse42, WorkTimeKernels::Avx2}) {
+            WorkTimeKernels::setLevel(level);
+            const QByteArray context = QByteArray(WorkTimeKernels::levelName(WorkTimeKernels::activeLevel()))
+                + " count " + QByteArray::number(count);
+
+            QVector<qint16> minutes(count);
+            WorkTimeKernels::shiftMinutes(startMinutes.constData(), endMinutes.constData(), minutes.data(), count);
+            QVERIFY2(minutes == expectedMinutes, context.constData());
+            QVector<qint64> weekly((count + 6) / 7);
+            WorkTimeKernels::weeklyTotals(daily.constData(), count, weekly.data());
+            QVERIFY2(weekly == expectedWeekly, context.constData());
+            QVERIFY2(WorkTimeKernels::sumMinutesInDayRange(days.constData(), startMinutes.constData(),
+                                                           endMinutes.constData(), count, fromDay, toDay) == expectedSum,
+                     context.constData());
+        }
+    }
+    WorkTimeKernels::setLevel(originalLevel);
+
+    // 월 조회가 함께 돌려주는 근무 분 합계는 색인의 합계와 같아야 함
+    DataManager dataManager;
+    QList<int> employeeIds;
+    QList<WorkLog> shifts;
+    populate(dataManager, kSmallEmployeeCount, kSmallYears, &employeeIds, &shifts);
+    for (int employeeId : std::as_const(employeeIds)) {
+        for (int month = 1; month <= 12; ++month) {
+            const QDate first(2020, month, 1);
+            qint64 totalMinutes = -1;
+            const QList<WorkLog> logs = dataManager.getWorkLogsForEmployeeForMonth(employeeId, 2020, month, &totalMinutes);
+            qint64 expected = 0;
+            for (const WorkLog &log : logs) {
+                expected += log.getMinutesWorked();
+            }
+            QCOMPARE(totalMinutes, expected);
+            QCOMPARE(totalMinutes, dataManager.getTotalMinutesForEmployee(employeeId, first, first.addMonths(1).addDays(-1)));
+        }
+    }
+}
+
+QTEST_GUILESS_MAIN(CoreTest)
+#include "tst_core.moc"
@@ -26,15 +26,19 @@ void WorkLog::setStartTime(const QTime &time) { m_startTime = time; }
 QTime WorkLog::getEndTime() const { return m_endTime; }
 void WorkLog::setEndTime(const QTime &time) { m_endTime = time; }
 
-// 실제 근무 시간을 시간 단위로 계산 (자정 넘어가는 경우 처리 포함)
+// 실제 근무 시간을 분 단위로 계산 (자정 넘어가는 경우 처리 포함)
+// 저장소와 같이 출근/퇴근 시각의 초는 버리고 분끼리 뺌
+int WorkLog::getMinutesWorked() const {
+    if (!m_startTime.isValid() || !m_endTime.isValid()) return 0;
+    int minutes = (m_endTime.hour() * 60 + m_endTime.minute()) - (m_startTime.hour() * 60 + m_startTime.minute());
+    // 야간 근무 등으로 종료 시간이 다음 날이라 분이 음수이면, 하루(24시간)만큼 더해줌
+    if (minutes < 0) minutes += 24 * 60;
+    return minutes;
+}
+
+// 실제 근무 시간을 시간 단위로 계산 (표시용, 급여 계산에는 getMinutesWorked 사용)
 double WorkLog::getHoursWorked() const {
-    if (!m_startTime.isValid() || !m_endTime.isValid()) return 0.0;
-    // 시작 시간부터 종료 시간까지의 초(second) 차이를 계산
-    int seconds = m_startTime.secsTo(m_endTime);
-    // 야간 근무 등으로 종료 시간이 다음 날이라 초가 음수이면, 하루(24시간)만큼 더해줌
-    if (seconds < 0) seconds += 24 * 60 * 60;
-    // 계산된 초를 3600으로 나누어 시간 단위로 변환
-    return static_cast<double>(seconds) / 3600.0;
+    return static_cast<double>(getMinutesWorked()) / 60.0;
 }
 
 
@@ -60,3 +64,32 @@ WorkLog WorkLog::fromJson(const QJsonObject &json)
     // 읽어온 정보로 새로운 WorkLog 객체를 생성하여 반환
     return WorkLog(employeeId, date, startTime, endTime);
 }
+
+namespace {
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+inline int twoDigits(const char *p) { return (p[0] - '0') * 10 + (p[1] - '0'); }
+}
+
+// "yyyy-MM-dd" 고정 폭 날짜 변환
+QDate WorkLog::parseIsoDate(const QByteArray &utf8)
+{
+    const char *p = utf8.constData();
+    if (utf8.size() == 10 && p[4] == '-' && p[7] == '-'
+        && isDigit(p[0]) && isDigit(p[1]) && isDigit(p[2]) && isDigit(p[3])
+        && isDigit(p[5]) && isDigit(p[6]) && isDigit(p[8]) && isDigit(p[9])) {
+        int year = twoDigits(p) * 100 + twoDigits(p + 2);
+        return QDate(year, twoDigits(p + 5), twoDigits(p + 8)); // 범위를 벗어나면 fromString처럼 무효 날짜
+    }
+    return QDate::fromString(QString::fromUtf8(utf8), Qt::ISODate);
+}
+
+// "HH:mm:ss" 고정 폭 시간 변환
+QTime WorkLog::parseTime(const QByteArray &utf8)
+{
+    const char *p = utf8.constData();
+    if (utf8.size() == 8 && p[2] == ':' && p[5] == ':'
+        && isDigit(p[0]) && isDigit(p[1]) && isDigit(p[3]) && isDigit(p[4]) && isDigit(p[6]) && isDigit(p[7])) {
+        return QTime(twoDigits(p), twoDigits(p + 3), twoDigits(p + 6));
+    }
+    return QTime::fromString(QString::fromUtf8(utf8), "HH:mm:ss");
+}
@@ -4,6 +4,7 @@
 #include <QDate>
 #include <QTime>
 #include <QJsonObject>
+#include <QByteArray>
 
 // 근무 기록 한 건의 정보를 담는 데이터 클래스
 class WorkLog
@@ -24,8 +25,10 @@ public:
     void setStartTime(const QTime &time);
     QTime getEndTime() const;
     void setEndTime(const QTime &time);
-    // 출근/퇴근 시간으로 실제 근무 시간을 계산해서 반환
+    // 출근/퇴근 시간으로 실제 근무 시간을 계산해서 반환 (표시용)
     double getHoursWorked() const;
+    // 실제 근무 시간을 분 단위 정수로 반환 (급여 계산과 누적 합 색인용)
+    int getMinutesWorked() const;
 
     // --- JSON 변환 함수 (파일 저장/불러오기용) ---
     // 객체 정보를 JSON으로 변환
@@ -33,6 +36,11 @@ public:
     // JSON 데이터로 객체 생성
     static WorkLog fromJson(const QJsonObject &json);
 
+    // toJson()이 쓰는 "yyyy-MM-dd" / "HH:mm:ss" 고정 폭 문자열을 빠르게 변환
+    // (형식이 다르면 QDate/QTime::fromString으로 처리하므로 결과는 fromJson과 같음)
+    static QDate parseIsoDate(const QByteArray &utf8);
+    static QTime parseTime(const QByteArray &utf8);
+
 private:
     int m_employeeId; // 직원 고유 ID
     QDate m_date; // 근무 날짜
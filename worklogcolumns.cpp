@@ -0,0 +1,147 @@
+#include "worklogcolumns.h"
+#include "worktimekernels.h"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+const qint32 WorkLogColumns::kInvalidDay = std::numeric_limits<qint32>::min();
+
+qint32 WorkLogColumns::encodeDate(const QDate &date)
+{
+    return date.isValid() ? qint32(date.toJulianDay()) : kInvalidDay;
+}
+
+QDate WorkLogColumns::decodeDate(qint32 day)
+{
+    return day == kInvalidDay ? QDate() : QDate::fromJulianDay(day);
+}
+
+qint16 WorkLogColumns::encodeTime(const QTime &time)
+{
+    return time.isValid() ? static_cast<qint16>(time.hour() * 60 + time.minute()) : kInvalidMinute;
+}
+
+QTime WorkLogColumns::decodeTime(qint16 minute)
+{
+    return minute >= 0 ? QTime(minute / 60, minute % 60) : QTime();
+}
+
+void WorkLogColumns::reserve(int count)
+{
+    m_days.reserve(count);
+    m_startMinutes.reserve(count);
+    m_endMinutes.reserve(count);
+}
+
+int WorkLogColumns::minutesAt(int row) const
+{
+    const qint16 start = m_startMinutes[row];
+    const qint16 end = m_endMinutes[row];
+    if (start < 0 || end < 0) return 0;
+    int minutes = end - start;
+    if (minutes < 0) minutes += 24 * 60; // 야간 근무
+    return minutes;
+}
+
+void WorkLogColumns::minutesForRows(int fromRow, int toRow, qint16 *out) const
+{
+    WorkTimeKernels::shiftMinutes(m_startMinutes.constData() + fromRow, m_endMinutes.constData() + fromRow,
+                                  out, toRow - fromRow);
+}
+
+qint64 WorkLogColumns::sumMinutes(qint32 fromDay, qint32 toDay) const
+{
+    const int fromRow = lowerBound(fromDay);
+    const int toRow = upperBound(toDay);
+    if (fromRow >= toRow) return 0;
+    return WorkTimeKernels::sumMinutesInDayRange(m_days.constData() + fromRow, m_startMinutes.constData() + fromRow,
+                                                 m_endMinutes.constData() + fromRow, toRow - fromRow, fromDay, toDay);
+}
+
+WorkLog WorkLogColumns::at(int employeeId, int row) const
+{
+    return WorkLog(employeeId, decodeDate(m_days[row]),
+                   decodeTime(m_startMinutes[row]), decodeTime(m_endMinutes[row]));
+}
+
+int WorkLogColumns::lowerBound(qint32 day) const
+{
+    return int(std::lower_bound(m_days.cbegin(), m_days.cend(), day) - m_days.cbegin());
+}
+
+int WorkLogColumns::upperBound(qint32 day) const
+{
+    return int(std::upper_bound(m_days.cbegin(), m_days.cend(), day) - m_days.cbegin());
+}
+
+void WorkLogColumns::append(const WorkLog &log)
+{
+    m_days.append(encodeDate(log.getDate()));
+    m_startMinutes.append(encodeTime(log.getStartTime()));
+    m_endMinutes.append(encodeTime(log.getEndTime()));
+}
+
+void WorkLogColumns::appendRows(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count)
+{
+    const int oldSize = m_days.size();
+    m_days.resize(oldSize + count);
+    m_startMinutes.resize(oldSize + count);
+    m_endMinutes.resize(oldSize + count);
+    std::copy(days, days + count, m_days.begin() + oldSize);
+    std::copy(startMinutes, startMinutes + count, m_startMinutes.begin() + oldSize);
+    std::copy(endMinutes, endMinutes + count, m_endMinutes.begin() + oldSize);
+}
+
+int WorkLogColumns::insertSorted(const WorkLog &log)
+{
+    const qint32 day = encodeDate(log.getDate());
+    const int row = upperBound(day);
+    m_days.insert(row, day);
+    m_startMinutes.insert(row, encodeTime(log.getStartTime()));
+    m_endMinutes.insert(row, encodeTime(log.getEndTime()));
+    return row;
+}
+
+void WorkLogColumns::replace(int row, const WorkLog &log)
+{
+    m_days[row] = encodeDate(log.getDate());
+    m_startMinutes[row] = encodeTime(log.getStartTime());
+    m_endMinutes[row] = encodeTime(log.getEndTime());
+}
+
+void WorkLogColumns::remove(int row, int count)
+{
+    m_days.remove(row, count);
+    m_startMinutes.remove(row, count);
+    m_endMinutes.remove(row, count);
+}
+
+void WorkLogColumns::sortByDay()
+{
+    if (std::is_sorted(m_days.cbegin(), m_days.cend())) return; // 파일에 날짜순으로 저장된 경우가 대부분
+
+    // 행 번호를 안정 정렬한 뒤 세 열을 그 순서대로 다시 모음
+    QVector<int> order(m_days.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) { return m_days[a] < m_days[b]; });
+
+    QVector<qint32> days(order.size());
+    QVector<qint16> startMinutes(order.size());
+    QVector<qint16> endMinutes(order.size());
+    for (int i = 0; i < order.size(); ++i) {
+        days[i] = m_days[order[i]];
+        startMinutes[i] = m_startMinutes[order[i]];
+        endMinutes[i] = m_endMinutes[order[i]];
+    }
+    m_days = std::move(days);
+    m_startMinutes = std::move(startMinutes);
+    m_endMinutes = std::move(endMinutes);
+}
+
+void WorkLogColumns::appendTo(int employeeId, int fromRow, int toRow, QList<WorkLog> *out) const
+{
+    out->reserve(out->size() + (toRow - fromRow));
+    for (int row = fromRow; row < toRow; ++row) {
+        out->append(at(employeeId, row));
+    }
+}
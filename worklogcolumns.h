@@ -0,0 +1,76 @@
+#ifndef WORKLOGCOLUMNS_H
+#define WORKLOGCOLUMNS_H
+
+#include <QList>
+#include <QVector>
+#include <QDate>
+#include <QTime>
+#include "worklog.h"
+
+// 직원 한 명의 근무 기록을 열 단위 배열로 저장하는 컨테이너
+// 날짜(율리우스 일), 출근 분, 퇴근 분을 각각 연속된 배열에 담으므로 한 건당 8바이트이고,
+// 날짜 검색과 근무 시간 합계가 WorkLog 객체를 만들지 않고 배열만 훑어서 끝남
+// 직원 ID는 DataManager의 해시 키로 나누어 두므로 열로 저장하지 않음
+// 행은 날짜순이고 같은 날짜 안에서는 입력 순서를 유지함 (append 후에는 sortByDay 필요)
+// 시간은 분 단위로 저장하므로 초는 버려짐 (바이너리 스냅샷, 입력 화면과 같은 정밀도)
+// 근무 시간 계산(WorkLog::getMinutesWorked)도 원래 초를 보지 않으므로 급여는 달라지지 않음
+// 초가 있는 기록을 불러오거나 추가하면 DataManager가 경고를 남기고, 다음 저장부터 HH:mm:00으로 기록됨
+class WorkLogColumns
+{
+public:
+    static const qint32 kInvalidDay;   // 무효 날짜 (모든 유효한 날짜보다 앞에 정렬됨)
+    static const qint16 kInvalidMinute = -1; // 무효 시간
+
+    static qint32 encodeDate(const QDate &date);
+    static QDate decodeDate(qint32 day);
+    static qint16 encodeTime(const QTime &time);
+    static QTime decodeTime(qint16 minute);
+
+    int size() const { return m_days.size(); }
+    bool isEmpty() const { return m_days.isEmpty(); }
+    void reserve(int count);
+
+    qint32 dayAt(int row) const { return m_days[row]; }
+    qint16 startMinuteAt(int row) const { return m_startMinutes[row]; }
+    qint16 endMinuteAt(int row) const { return m_endMinutes[row]; }
+    // 행의 근무 시간(분) - WorkLog::getMinutesWorked와 같은 규칙 (자정을 넘기면 하루를 더함)
+    int minutesAt(int row) const;
+    // [fromRow, toRow) 행들의 근무 시간(분)을 out에 씀 (minutesAt과 같은 규칙, 집계 커널로 한 번에 계산)
+    void minutesForRows(int fromRow, int toRow, qint16 *out) const;
+    // 날짜가 [fromDay, toDay]인 행들의 근무 시간(분) 합계 (이진 탐색한 구간을 집계 커널로 훑음)
+    qint64 sumMinutes(qint32 fromDay, qint32 toDay) const;
+    // 열 배열 직접 접근 (집계 커널용, 행 수는 size())
+    const qint32 *dayData() const { return m_days.constData(); }
+    const qint16 *startMinuteData() const { return m_startMinutes.constData(); }
+    const qint16 *endMinuteData() const { return m_endMinutes.constData(); }
+    // 행을 API용 WorkLog 값으로 만듦
+    WorkLog at(int employeeId, int row) const;
+
+    // 날짜가 day 이상인 첫 행 / day보다 큰 첫 행 (이진 탐색)
+    int lowerBound(qint32 day) const;
+    int upperBound(qint32 day) const;
+    int lowerBound(const QDate &date) const { return lowerBound(encodeDate(date)); }
+    int upperBound(const QDate &date) const { return upperBound(encodeDate(date)); }
+
+    // 끝에 덧붙임 (불러오기용, 정렬 순서는 지키지 않음)
+    void append(const WorkLog &log);
+    // 이미 인코딩된 열 값 count개를 끝에 통째로 덧붙임 (바이너리 스냅샷 불러오기용, 정렬 순서는 지키지 않음)
+    void appendRows(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count);
+    // 같은 날짜의 기존 기록들 뒤에 삽입하고 들어간 행 번호를 반환
+    int insertSorted(const WorkLog &log);
+    // 날짜가 같은 기록으로 제자리 교체 (정렬 순서가 바뀌지 않을 때만 사용)
+    void replace(int row, const WorkLog &log);
+    void remove(int row, int count = 1);
+    // 날짜순 안정 정렬 (같은 날짜는 기존 순서 유지)
+    void sortByDay();
+
+    // [fromRow, toRow) 행들을 WorkLog로 만들어 out 끝에 덧붙임
+    void appendTo(int employeeId, int fromRow, int toRow, QList<WorkLog> *out) const;
+
+private:
+    QVector<qint32> m_days;         // 율리우스 일 (무효면 kInvalidDay)
+    QVector<qint16> m_startMinutes; // 자정부터의 출근 분 (무효면 kInvalidMinute)
+    QVector<qint16> m_endMinutes;   // 자정부터의 퇴근 분 (무효면 kInvalidMinute)
+};
+
+#endif // WORKLOGCOLUMNS_H
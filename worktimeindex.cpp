@@ -0,0 +1,163 @@
+#include "worktimeindex.h"
+#include "worktimekernels.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+// 범위를 넓힐 때 한 번에 늘리는 최소 일수 (잦은 재구성 방지)
+const int kMinGrowthDays = 366;
+}
+
+WorkTimeIndex::WorkTimeIndex() : m_firstDay(0)
+{
+}
+
+qint64 WorkTimeIndex::mondayOf(qint64 julianDay)
+{
+    qint64 dayOfWeek = julianDay % 7; // 0 = 월요일
+    if (dayOfWeek < 0) dayOfWeek += 7;
+    return julianDay - dayOfWeek;
+}
+
+void WorkTimeIndex::rebuild(const WorkLogColumns &columns)
+{
+    m_daily.clear();
+    m_tree.clear();
+    m_weekly.clear();
+
+    // 행은 날짜순이고 무효 날짜(kInvalidDay)는 맨 앞에 모이므로 지원 기간 안의 첫 행과 마지막 행이 범위
+    const int firstRow = columns.lowerBound(qint32(kFirstSupportedDay));
+    const int endRow = columns.upperBound(qint32(kLastSupportedDay));
+    if (firstRow >= endRow) return; // 지원 기간 안의 날짜가 없음
+    const qint64 firstDay = columns.dayAt(firstRow);
+    const qint64 lastDay = columns.dayAt(endRow - 1);
+
+    m_firstDay = mondayOf(firstDay);
+    Q_ASSERT(lastDay - m_firstDay + 1 <= std::numeric_limits<int>::max());
+    m_daily.fill(0, int(lastDay - m_firstDay + 1));
+
+    // 근무 분(자정 넘김 보정 포함)은 출근/퇴근 열을 커널로 한 번에 계산한 뒤 날짜별로 더함
+    const int rowCount = endRow - firstRow;
+    QVector<qint16> minutes(rowCount);
+    columns.minutesForRows(firstRow, endRow, minutes.data());
+    const qint32 *days = columns.dayData() + firstRow;
+    qint64 *daily = m_daily.data();
+    for (int i = 0; i < rowCount; ++i) {
+        daily[days[i] - m_firstDay] += minutes[i];
+    }
+    rebuildAggregates();
+}
+
+void WorkTimeIndex::apply(const WorkLogColumns &columns, int row, int sign)
+{
+    const qint32 day = columns.dayAt(row);
+    if (!isSupportedDay(day)) return; // 무효 날짜(kInvalidDay)도 여기서 걸러짐
+    addMinutes(day, qint64(sign) * columns.minutesAt(row));
+}
+
+void WorkTimeIndex::addMinutes(qint64 julianDay, qint64 minutes)
+{
+    if (minutes == 0) return;
+    ensureDay(julianDay);
+
+    int index = int(julianDay - m_firstDay);
+    m_daily[index] += minutes;
+    m_weekly[index / 7] += minutes;
+    for (int i = index + 1; i <= m_tree.size() - 1; i += i & -i) {
+        m_tree[i] += minutes;
+    }
+}
+
+void WorkTimeIndex::ensureDay(qint64 julianDay)
+{
+    Q_ASSERT(isSupportedDay(julianDay));
+    if (m_daily.isEmpty()) {
+        m_firstDay = mondayOf(julianDay);
+        m_daily.fill(0, int(std::min<qint64>(kMinGrowthDays, kLastSupportedDay - m_firstDay + 1)));
+        rebuildAggregates();
+        return;
+    }
+
+    const qint64 lastDay = m_firstDay + m_daily.size() - 1;
+    if (julianDay >= m_firstDay && julianDay <= lastDay) return;
+
+    // 현재 크기만큼(최소 kMinGrowthDays) 여유를 두고 넓힌 뒤 트리를 O(n)으로 다시 만듦
+    // 여유분은 지원 기간에서 잘라 내므로 범위는 최대 지원 기간 전체 (kFirstSupportedDay가 월요일이라 정렬도 유지)
+    const qint64 growth = std::max<qint64>(m_daily.size(), kMinGrowthDays);
+    qint64 newFirstDay = m_firstDay;
+    qint64 newLastDay = lastDay;
+    if (julianDay < m_firstDay) {
+        newFirstDay = mondayOf(std::max(std::min(julianDay, m_firstDay - growth), kFirstSupportedDay));
+    } else {
+        newLastDay = std::min(std::max(julianDay, lastDay + growth), kLastSupportedDay);
+    }
+    Q_ASSERT(newLastDay - newFirstDay + 1 <= std::numeric_limits<int>::max());
+    if (newFirstDay < m_firstDay) {
+        m_daily.insert(0, int(m_firstDay - newFirstDay), 0);
+        m_firstDay = newFirstDay;
+    } else {
+        m_daily.resize(int(newLastDay - m_firstDay + 1)); // 새 칸은 0으로 채워짐
+    }
+    rebuildAggregates();
+}
+
+void WorkTimeIndex::rebuildAggregates()
+{
+    const int n = m_daily.size();
+    m_tree.fill(0, n + 1);
+    m_weekly.resize((n + 6) / 7);
+    WorkTimeKernels::weeklyTotals(m_daily.constData(), n, m_weekly.data());
+    for (int i = 1; i <= n; ++i) {
+        m_tree[i] += m_daily[i - 1];
+        int parent = i + (i & -i);
+        if (parent <= n) {
+            m_tree[parent] += m_tree[i];
+        }
+    }
+}
+
+qint64 WorkTimeIndex::prefixSum(int count) const
+{
+    qint64 sum = 0;
+    for (int i = count; i > 0; i -= i & -i) {
+        sum += m_tree[i];
+    }
+    return sum;
+}
+
+qint64 WorkTimeIndex::sumMinutes(qint64 fromDay, qint64 toDay) const
+{
+    if (m_daily.isEmpty()) return 0;
+
+    const qint64 lastDay = m_firstDay + m_daily.size() - 1;
+    fromDay = std::max(fromDay, m_firstDay);
+    toDay = std::min(toDay, lastDay);
+    if (fromDay > toDay) return 0;
+
+    return prefixSum(int(toDay - m_firstDay + 1)) - prefixSum(int(fromDay - m_firstDay));
+}
+
+QVector<QPair<qint64, qint64>> WorkTimeIndex::weeklyMinutes(qint64 fromDay, qint64 toDay) const
+{
+    QVector<QPair<qint64, qint64>> weeks;
+    if (m_daily.isEmpty()) return weeks;
+
+    const qint64 lastDay = m_firstDay + m_daily.size() - 1;
+    const qint64 from = std::max(fromDay, m_firstDay);
+    const qint64 to = std::min(toDay, lastDay);
+    if (from > to) return weeks;
+
+    const int firstWeek = int((from - m_firstDay) / 7);
+    const int lastWeek = int((to - m_firstDay) / 7);
+    for (int week = firstWeek; week <= lastWeek; ++week) {
+        const qint64 weekStart = m_firstDay + qint64(week) * 7;
+        const qint64 weekEnd = weekStart + 6;
+        const qint64 minutes = (weekStart >= fromDay && weekEnd <= toDay)
+                                   ? m_weekly[week]
+                                   : sumMinutes(std::max(weekStart, fromDay), std::min(weekEnd, toDay));
+        if (minutes != 0) {
+            weeks.append(qMakePair(weekStart, minutes));
+        }
+    }
+    return weeks;
+}
@@ -0,0 +1,57 @@
+#ifndef WORKTIMEINDEX_H
+#define WORKTIMEINDEX_H
+
+#include <QList>
+#include <QPair>
+#include <QVector>
+#include "worklogcolumns.h"
+
+// 직원 한 명의 일별 근무 시간(분)을 누적 합으로 관리하는 색인
+// 날짜(율리우스 일) 오프셋을 키로 하는 펜윅 트리(Fenwick tree)를 사용하므로
+// 임의 기간의 합계 조회와 근무 기록 추가/삭제 반영이 모두 O(log n)
+// 주휴수당 계산용으로 월요일 시작 주 단위 합계도 함께 유지함 (범위 시작일은 항상 월요일)
+// 일별 배열이 날짜 범위만큼 커지므로 지원 기간(1900-01-01 ~ 2199-12-31) 밖의 날짜는 색인하지 않음
+// (DataManager가 추가와 불러오기에서 기간 밖의 근무 기록을 거부하므로 배열은 최대 약 11만 칸)
+class WorkTimeIndex
+{
+public:
+    static constexpr qint64 kFirstSupportedDay = 2415021; // 1900-01-01 (월요일)의 율리우스 일
+    static constexpr qint64 kLastSupportedDay = 2524593;  // 2199-12-31의 율리우스 일
+
+    WorkTimeIndex();
+
+    static bool isSupportedDay(qint64 julianDay)
+    {
+        return julianDay >= kFirstSupportedDay && julianDay <= kLastSupportedDay;
+    }
+
+    // 근무 기록 열의 날짜/분 배열만 훑어서 색인을 한 번에 다시 만듦 (O(n))
+    void rebuild(const WorkLogColumns &columns);
+    // 무효 날짜와 지원 기간 밖의 행은 건너뜀
+    // 열의 row번째 근무 기록을 더하거나(sign = 1) 뺌(sign = -1)
+    void apply(const WorkLogColumns &columns, int row, int sign);
+
+    // [fromDay, toDay] 기간(율리우스 일, 양 끝 포함)의 근무 분 합계
+    qint64 sumMinutes(qint64 fromDay, qint64 toDay) const;
+    // 기간과 겹치는 주마다 (그 주 월요일의 율리우스 일, 기간 안에 든 날들의 근무 분)를 반환
+    // 기간에 통째로 들어가는 주는 미리 계산된 주 합계를 그대로 쓰고, 양 끝에 걸친 주만 트리로 계산
+    // 근무 시간이 0인 주는 생략
+    QVector<QPair<qint64, qint64>> weeklyMinutes(qint64 fromDay, qint64 toDay) const;
+
+    // 해당 날짜가 속한 주의 월요일 (율리우스 일 0이 월요일)
+    static qint64 mondayOf(qint64 julianDay);
+    bool isEmpty() const { return m_daily.isEmpty(); }
+
+private:
+    void addMinutes(qint64 julianDay, qint64 minutes);
+    void ensureDay(qint64 julianDay); // 해당 날짜가 들어가도록 지원 기간 안에서 범위를 넓힘 (필요하면 트리 재구성)
+    void rebuildAggregates(); // 일별 값으로 펜윅 트리와 주 합계를 다시 만듦
+    qint64 prefixSum(int count) const; // 앞에서부터 count일의 합
+
+    qint64 m_firstDay;        // m_daily[0]에 해당하는 율리우스 일 (월요일)
+    QVector<qint64> m_daily;  // 일별 근무 분
+    QVector<qint64> m_tree;   // 펜윅 트리 (1부터 시작하는 인덱스)
+    QVector<qint64> m_weekly; // 주별 근무 분 (m_weekly[w] = m_firstDay + 7w부터 7일)
+};
+
+#endif // WORKTIMEINDEX_H
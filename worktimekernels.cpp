@@ -0,0 +1,267 @@
+#include "worktimekernels.h"
+#include <QAtomicInt>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define WORKTIME_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace WorkTimeKernels {
+
+namespace {
+const qint16 kMinutesPerDay = 24 * 60;
+
+QAtomicInt s_level(-1); // -1이면 아직 CPU 기능을 확인하지 않음
+
+Level detectLevel()
+{
+#ifdef WORKTIME_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Avx2;
+    if (__builtin_cpu_supports("sse4.2")) return Sse42;
+#endif
+    return Scalar;
+}
+
+// --- 스칼라 구현 (남는 꼬리 부분 처리에도 사용) ---
+void shiftMinutesScalar(const qint16 *startMinutes, const qint16 *endMinutes, qint16 *out, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        const qint16 start = startMinutes[i];
+        const qint16 end = endMinutes[i];
+        qint16 minutes = qint16(end - start);
+        if (minutes < 0) minutes += kMinutesPerDay;
+        out[i] = (start < 0 || end < 0) ? qint16(0) : minutes;
+    }
+}
+
+void weeklyTotalsScalar(const qint64 *daily, int dayCount, qint64 *weekly, int fromWeek)
+{
+    const int weekCount = (dayCount + 6) / 7;
+    for (int week = fromWeek; week < weekCount; ++week) {
+        const int first = week * 7;
+        const int last = qMin(first + 7, dayCount);
+        qint64 sum = 0;
+        for (int day = first; day < last; ++day) {
+            sum += daily[day];
+        }
+        weekly[week] = sum;
+    }
+}
+
+qint64 sumMinutesInDayRangeScalar(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count,
+                                  qint32 fromDay, qint32 toDay)
+{
+    qint64 sum = 0;
+    for (int i = 0; i < count; ++i) {
+        if (days[i] < fromDay || days[i] > toDay) continue;
+        const qint16 start = startMinutes[i];
+        const qint16 end = endMinutes[i];
+        if (start < 0 || end < 0) continue;
+        int minutes = end - start;
+        if (minutes < 0) minutes += kMinutesPerDay;
+        sum += minutes;
+    }
+    return sum;
+}
+
+#ifdef WORKTIME_KERNELS_X86
+// --- SSE4.2 구현 (8개씩) ---
+__attribute__((target("sse4.2")))
+void shiftMinutesSse42(const qint16 *startMinutes, const qint16 *endMinutes, qint16 *out, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i day = _mm_set1_epi16(kMinutesPerDay);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i start = _mm_loadu_si128(reinterpret_cast<const __m128i *>(startMinutes + i));
+        const __m128i end = _mm_loadu_si128(reinterpret_cast<const __m128i *>(endMinutes + i));
+        __m128i minutes = _mm_sub_epi16(end, start);
+        minutes = _mm_add_epi16(minutes, _mm_and_si128(_mm_cmplt_epi16(minutes, zero), day));
+        const __m128i invalid = _mm_or_si128(_mm_cmplt_epi16(start, zero), _mm_cmplt_epi16(end, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_andnot_si128(invalid, minutes));
+    }
+    shiftMinutesScalar(startMinutes + i, endMinutes + i, out + i, count - i);
+}
+
+__attribute__((target("sse4.2")))
+void weeklyTotalsSse42(const qint64 *daily, int dayCount, qint64 *weekly)
+{
+    const int fullWeeks = dayCount / 7;
+    for (int week = 0; week < fullWeeks; ++week) {
+        const qint64 *days = daily + week * 7;
+        __m128i sum = _mm_loadu_si128(reinterpret_cast<const __m128i *>(days));
+        sum = _mm_add_epi64(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(days + 2)));
+        sum = _mm_add_epi64(sum, _mm_loadu_si128(reinterpret_cast<const __m128i *>(days + 4)));
+        weekly[week] = _mm_extract_epi64(sum, 0) + _mm_extract_epi64(sum, 1) + days[6];
+    }
+    weeklyTotalsScalar(daily, dayCount, weekly, fullWeeks);
+}
+
+// 날짜 8개(32비트 두 묶음)가 범위 밖이면 해당 16비트 칸이 모두 1인 마스크
+__attribute__((target("sse4.2")))
+__m128i outOfRangeMaskSse42(const qint32 *days, __m128i fromDay, __m128i toDay)
+{
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(days));
+    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(days + 4));
+    const __m128i lowOut = _mm_or_si128(_mm_cmpgt_epi32(fromDay, low), _mm_cmpgt_epi32(low, toDay));
+    const __m128i highOut = _mm_or_si128(_mm_cmpgt_epi32(fromDay, high), _mm_cmpgt_epi32(high, toDay));
+    return _mm_packs_epi32(lowOut, highOut); // -1/0은 포화 변환해도 그대로
+}
+
+__attribute__((target("sse4.2")))
+qint64 sumMinutesInDayRangeSse42(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count,
+                                 qint32 fromDay, qint32 toDay)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i day = _mm_set1_epi16(kMinutesPerDay);
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i from = _mm_set1_epi32(fromDay);
+    const __m128i to = _mm_set1_epi32(toDay);
+    __m128i total = _mm_setzero_si128(); // 64비트 2칸
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i start = _mm_loadu_si128(reinterpret_cast<const __m128i *>(startMinutes + i));
+        const __m128i end = _mm_loadu_si128(reinterpret_cast<const __m128i *>(endMinutes + i));
+        __m128i minutes = _mm_sub_epi16(end, start);
+        minutes = _mm_add_epi16(minutes, _mm_and_si128(_mm_cmplt_epi16(minutes, zero), day));
+        __m128i skip = _mm_or_si128(_mm_cmplt_epi16(start, zero), _mm_cmplt_epi16(end, zero));
+        skip = _mm_or_si128(skip, outOfRangeMaskSse42(days + i, from, to));
+        // 16비트 8칸을 두 칸씩 더해 32비트 4칸으로 만든 뒤 64비트로 넓혀 누적 (칸당 최대 2 * 1439)
+        const __m128i pairs = _mm_madd_epi16(_mm_andnot_si128(skip, minutes), ones);
+        total = _mm_add_epi64(total, _mm_cvtepi32_epi64(pairs));
+        total = _mm_add_epi64(total, _mm_cvtepi32_epi64(_mm_srli_si128(pairs, 8)));
+    }
+    return _mm_extract_epi64(total, 0) + _mm_extract_epi64(total, 1)
+        + sumMinutesInDayRangeScalar(days + i, startMinutes + i, endMinutes + i, count - i, fromDay, toDay);
+}
+
+// --- AVX2 구현 (16개씩) ---
+__attribute__((target("avx2")))
+void shiftMinutesAvx2(const qint16 *startMinutes, const qint16 *endMinutes, qint16 *out, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i day = _mm256_set1_epi16(kMinutesPerDay);
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i start = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(startMinutes + i));
+        const __m256i end = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(endMinutes + i));
+        __m256i minutes = _mm256_sub_epi16(end, start);
+        minutes = _mm256_add_epi16(minutes, _mm256_and_si256(_mm256_cmpgt_epi16(zero, minutes), day));
+        const __m256i invalid = _mm256_or_si256(_mm256_cmpgt_epi16(zero, start), _mm256_cmpgt_epi16(zero, end));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_andnot_si256(invalid, minutes));
+    }
+    shiftMinutesScalar(startMinutes + i, endMinutes + i, out + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void weeklyTotalsAvx2(const qint64 *daily, int dayCount, qint64 *weekly)
+{
+    const int fullWeeks = dayCount / 7;
+    for (int week = 0; week < fullWeeks; ++week) {
+        const qint64 *days = daily + week * 7;
+        const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(days)); // 0~3일
+        const __m128i rest = _mm_loadu_si128(reinterpret_cast<const __m128i *>(days + 4));  // 4~5일
+        __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(first), _mm256_extracti128_si256(first, 1));
+        sum = _mm_add_epi64(sum, rest);
+        weekly[week] = _mm_extract_epi64(sum, 0) + _mm_extract_epi64(sum, 1) + days[6];
+    }
+    weeklyTotalsScalar(daily, dayCount, weekly, fullWeeks);
+}
+__attribute__((target("avx2")))
+qint64 sumMinutesInDayRangeAvx2(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count,
+                                qint32 fromDay, qint32 toDay)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i day = _mm256_set1_epi16(kMinutesPerDay);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i from = _mm256_set1_epi32(fromDay);
+    const __m256i to = _mm256_set1_epi32(toDay);
+    __m256i total = _mm256_setzero_si256(); // 64비트 4칸
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i start = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(startMinutes + i));
+        const __m256i end = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(endMinutes + i));
+        __m256i minutes = _mm256_sub_epi16(end, start);
+        minutes = _mm256_add_epi16(minutes, _mm256_and_si256(_mm256_cmpgt_epi16(zero, minutes), day));
+        __m256i skip = _mm256_or_si256(_mm256_cmpgt_epi16(zero, start), _mm256_cmpgt_epi16(zero, end));
+
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(days + i));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(days + i + 8));
+        const __m256i lowOut = _mm256_or_si256(_mm256_cmpgt_epi32(from, low), _mm256_cmpgt_epi32(low, to));
+        const __m256i highOut = _mm256_or_si256(_mm256_cmpgt_epi32(from, high), _mm256_cmpgt_epi32(high, to));
+        // packs는 128비트 단위로 섞으므로 64비트 조각 순서를 0, 2, 1, 3으로 되돌려 행 순서를 맞춤
+        const __m256i dayOut = _mm256_permute4x64_epi64(_mm256_packs_epi32(lowOut, highOut), 0xD8);
+        skip = _mm256_or_si256(skip, dayOut);
+
+        const __m256i pairs = _mm256_madd_epi16(_mm256_andnot_si256(skip, minutes), ones);
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+    }
+    const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    return _mm_extract_epi64(half, 0) + _mm_extract_epi64(half, 1)
+        + sumMinutesInDayRangeScalar(days + i, startMinutes + i, endMinutes + i, count - i, fromDay, toDay);
+}
+#endif
+} // namespace
+
+Level activeLevel()
+{
+    int level = s_level.loadAcquire();
+    if (level < 0) {
+        level = detectLevel();
+        s_level.storeRelease(level);
+    }
+    return static_cast<Level>(level);
+}
+
+void setLevel(Level level)
+{
+    s_level.storeRelease(qMin(level, detectLevel()));
+}
+
+const char *levelName(Level level)
+{
+    switch (level) {
+    case Avx2: return "avx2";
+    case Sse42: return "sse4.2";
+    case Scalar: break;
+    }
+    return "scalar";
+}
+
+void shiftMinutes(const qint16 *startMinutes, const qint16 *endMinutes, qint16 *out, int count)
+{
+    switch (activeLevel()) {
+#ifdef WORKTIME_KERNELS_X86
+    case Avx2: shiftMinutesAvx2(startMinutes, endMinutes, out, count); return;
+    case Sse42: shiftMinutesSse42(startMinutes, endMinutes, out, count); return;
+#endif
+    default: shiftMinutesScalar(startMinutes, endMinutes, out, count); return;
+    }
+}
+
+void weeklyTotals(const qint64 *daily, int dayCount, qint64 *weekly)
+{
+    switch (activeLevel()) {
+#ifdef WORKTIME_KERNELS_X86
+    case Avx2: weeklyTotalsAvx2(daily, dayCount, weekly); return;
+    case Sse42: weeklyTotalsSse42(daily, dayCount, weekly); return;
+#endif
+    default: weeklyTotalsScalar(daily, dayCount, weekly, 0); return;
+    }
+}
+
+qint64 sumMinutesInDayRange(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count,
+                            qint32 fromDay, qint32 toDay)
+{
+    switch (activeLevel()) {
+#ifdef WORKTIME_KERNELS_X86
+    case Avx2: return sumMinutesInDayRangeAvx2(days, startMinutes, endMinutes, count, fromDay, toDay);
+    case Sse42: return sumMinutesInDayRangeSse42(days, startMinutes, endMinutes, count, fromDay, toDay);
+#endif
+    default: return sumMinutesInDayRangeScalar(days, startMinutes, endMinutes, count, fromDay, toDay);
+    }
+}
+
+} // namespace WorkTimeKernels
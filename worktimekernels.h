@@ -0,0 +1,38 @@
+#ifndef WORKTIMEKERNELS_H
+#define WORKTIMEKERNELS_H
+
+#include <QtGlobal>
+
+// 근무 기록 열(연속 배열)을 훑는 집계 커널
+// x86에서는 실행 중인 CPU를 확인해 AVX2 / SSE4.2 구현을 고르고, 그 외에는 스칼라 구현을 씀
+// 모든 구현은 같은 결과를 내므로 호출하는 쪽은 수준을 신경 쓰지 않아도 됨
+namespace WorkTimeKernels {
+
+enum Level {
+    Scalar,
+    Sse42,
+    Avx2
+};
+
+// 현재 사용 중인 구현 수준 (처음 호출될 때 CPU 기능으로 결정)
+Level activeLevel();
+// 구현 수준을 강제로 지정 (벤치마크/검증용). CPU가 지원하지 않는 수준은 지원하는 최고 수준으로 낮춤
+void setLevel(Level level);
+const char *levelName(Level level);
+
+// 출근/퇴근 분 열로 근무 분을 계산해 out에 씀
+// 퇴근이 출근보다 이르면 자정을 넘긴 근무로 보고 24시간을 더하고, 어느 한쪽이 무효(음수)면 0
+void shiftMinutes(const qint16 *startMinutes, const qint16 *endMinutes, qint16 *out, int count);
+
+// 일별 합계를 7일씩 묶어 주별 합계를 만듦 (weekly[w] = daily[7w] + ... + daily[7w + 6])
+// 마지막 주가 7일보다 짧으면 있는 날만 더함. weekly는 (dayCount + 6) / 7칸이어야 함
+void weeklyTotals(const qint64 *daily, int dayCount, qint64 *weekly);
+
+// 날짜가 [fromDay, toDay] (율리우스 일, 양 끝 포함)에 드는 행만 골라 근무 분(shiftMinutes와 같은 규칙)을 더함
+// 날짜 열이 정렬되어 있지 않아도 됨 (무효 날짜 kInvalidDay는 가장 작은 값이라 fromDay가 유효하면 빠짐)
+qint64 sumMinutesInDayRange(const qint32 *days, const qint16 *startMinutes, const qint16 *endMinutes, int count,
+                            qint32 fromDay, qint32 toDay);
+
+} // namespace WorkTimeKernels
+
+#endif // WORKTIMEKERNELS_H